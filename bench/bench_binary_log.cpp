@@ -0,0 +1,104 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <ctime>
+#include <cstdio>
+#include <functional>
+#include <unistd.h>
+#include "../libftpp.hpp"
+
+static double threadCpuNanoseconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/*
+** Caller cost of logging "user {} took {} ms" with an integer and a
+** double: the string path (message built with to_string, async Logger),
+** the format-string LOG_INFO into the same async Logger, LOG_BIN_INFO
+** rendered in the background and LOG_BIN_INFO written raw to a file. Bursts fit in the rings, so the figures are the
+** hot path alone; draining happens between bursts and is not timed.
+** Time is the calling thread's CPU time, so on a machine with few cores
+** the background threads running alongside do not count against it. The
+** CycleClock read every entry needs is printed first: virtual machines
+** often make it several times slower than on bare metal.
+*/
+class NullSink : public Log::Sink
+{
+	public:
+		void write(const Log::Record &) override {}
+		void flush() override {}
+		void set_level(Log::LogLevel) override {}
+};
+
+static double run(const char *label, const std::function<void(size_t)> &statement, const std::function<void()> &drain) {
+	const size_t bursts = 200;
+	const size_t burst = 10000;
+	double nanoseconds = 0;
+
+	for (size_t b = 0; b < bursts; ++b) {
+		double start = threadCpuNanoseconds();
+		for (size_t i = 0; i < burst; ++i)
+			statement(i);
+		nanoseconds += threadCpuNanoseconds() - start;
+		drain();
+	}
+	double perCall = nanoseconds / (bursts * burst);
+	std::cout << std::left << std::setw(34) << label << std::right << std::fixed << std::setprecision(1)
+			  << std::setw(7) << perCall << " ns/call" << std::endl;
+	return perCall;
+}
+
+static double clockCost(size_t iterations) {
+	uint64_t sum = 0;
+	double start = threadCpuNanoseconds();
+
+	for (size_t i = 0; i < iterations; ++i)
+		sum += CycleClock::now();
+	return (threadCpuNanoseconds() - start + (sum & 1)) / iterations;
+}
+
+int main() {
+	std::cout << std::fixed << std::setprecision(1) << "CycleClock::now(): " << clockCost(10000000) << " ns" << std::endl;
+
+	Log::Logger logger("bench");
+	NullSink sink;
+	logger.addSink(&sink);
+	logger.setLogLevel(Log::LogLevel::INFO);
+
+	Log::AsyncConfig async;
+	async.capacity = 1 << 14;
+	logger.startAsync(async);
+	double text = run("LOG_INFO + to_string, async", [&logger](size_t i) {
+		LOG_INFO(logger, "user " + std::to_string(i) + " took " + std::to_string(i * 0.25) + " ms");
+	}, [&logger]() { logger.flush(); });
+	double formatted = run("LOG_INFO format string, async", [&logger](size_t i) {
+		LOG_INFO(logger, "user {} took {} ms", i, i * 0.25);
+	}, [&logger]() { logger.flush(); });
+	logger.stopAsync();
+
+	Log::BinaryLog::Config config;
+	Log::BinaryLog::start(config);
+	double background = run("LOG_BIN_INFO, background render", [&logger](size_t i) {
+		LOG_BIN_INFO(logger, "user {} took {} ms", i, i * 0.25);
+	}, []() { Log::BinaryLog::flush(); });
+
+	char path[] = "/tmp/libftpp_bench_binary_log_XXXXXX";
+	int fd = mkstemp(path);
+	if (fd >= 0)
+		close(fd);
+	config.path = path;
+	Log::BinaryLog::start(config);
+	double file = run("LOG_BIN_INFO, raw file", [&logger](size_t i) {
+		LOG_BIN_INFO(logger, "user {} took {} ms", i, i * 0.25);
+	}, []() { Log::BinaryLog::flush(); });
+	Log::BinaryLog::stop();
+	std::remove(path);
+
+	std::cout << std::setprecision(1) << "Speedup over to_string: " << text / formatted << "x (format string), "
+			  << text / background << "x (background), " << text / file << "x (file); dropped "
+			  << Log::BinaryLog::droppedEntries() << std::endl;
+	return 0;
+}
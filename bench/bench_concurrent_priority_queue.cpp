@@ -0,0 +1,81 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#include <queue>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include "../libftpp.hpp"
+
+// Baseline: one mutex around a std::priority_queue
+class LockedPriorityQueue {
+	public:
+		void push(int priority, int value) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			_queue.push({priority, value});
+		}
+
+		bool tryPop(int &value) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (_queue.empty())
+				return false;
+			value = _queue.top().second;
+			_queue.pop();
+			return true;
+		}
+
+	private:
+		std::mutex _mutex;
+		std::priority_queue<std::pair<int, int>> _queue;
+};
+
+template <typename TQueue>
+double run(TQueue &queue, int threads, int opsPerThread) {
+	for (int i = 0; i < 1024; ++i)
+		queue.push(i % 64, i);
+
+	std::atomic<bool> go{false};
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; ++t) {
+		workers.emplace_back([&queue, &go, t, opsPerThread]() {
+			uint32_t seed = t * 7919 + 1;
+			int value;
+			while (!go.load())
+				std::this_thread::yield();
+			for (int i = 0; i < opsPerThread; ++i) {
+				seed = seed * 1103515245 + 12345;
+				queue.push(static_cast<int>((seed >> 16) % 64), i);
+				queue.tryPop(value);
+			}
+		});
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	go.store(true);
+	for (auto &worker : workers)
+		worker.join();
+	auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	return (2.0 * threads * opsPerThread) / elapsed / 1e6;
+}
+
+int main() {
+	const int opsPerThread = 200000;
+	unsigned int maxThreads = std::max(8u, std::thread::hardware_concurrency());
+
+	std::cout << "push+pop pairs, " << opsPerThread << " per thread, Mops/s" << std::endl;
+	std::cout << std::setw(8) << "threads" << std::setw(22) << "mutex priority_queue" << std::setw(22) << "ConcurrentPQ" << std::endl;
+
+	for (unsigned int threads = 1; threads <= maxThreads; threads *= 2) {
+		LockedPriorityQueue locked;
+		ConcurrentPriorityQueue<int> sharded;
+
+		double lockedRate = run(locked, threads, opsPerThread);
+		double shardedRate = run(sharded, threads, opsPerThread);
+
+		std::cout << std::setw(8) << threads << std::fixed << std::setprecision(2)
+				  << std::setw(22) << lockedRate << std::setw(22) << shardedRate << std::endl;
+	}
+	return 0;
+}
@@ -0,0 +1,115 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+#if LIBFTPP_COROUTINES
+
+/*
+** Tens of thousands of logical operations on a 4-thread pool: coroutines
+** that sleep on the pool's timer heap, and socket pairs ping-ponging
+** through the IoReactor. Thread count is sampled while they are in flight.
+*/
+static size_t processThreads() {
+	std::ifstream status("/proc/self/status");
+	std::string line;
+
+	while (std::getline(status, line)) {
+		if (line.rfind("Threads:", 0) == 0)
+			return std::stoul(line.substr(8));
+	}
+	return 0;
+}
+
+static Task<void> sleepy(WorkerPool &pool, int steps) {
+	for (int i = 0; i < steps; ++i)
+		co_await pool.sleepFor(std::chrono::milliseconds(5));
+}
+
+static Task<void> pinger(IoReactor &reactor, int fd, int rounds) {
+	char byte = 'x';
+	for (int i = 0; i < rounds; ++i) {
+		::send(fd, &byte, 1, 0);
+		co_await reactor.readable(fd);
+		::recv(fd, &byte, 1, 0);
+	}
+}
+
+static Task<void> ponger(IoReactor &reactor, int fd, int rounds) {
+	char byte;
+	for (int i = 0; i < rounds; ++i) {
+		co_await reactor.readable(fd);
+		::recv(fd, &byte, 1, 0);
+		::send(fd, &byte, 1, 0);
+	}
+}
+
+static void sleepers(WorkerPool &pool, int count, int steps) {
+	std::vector<Future<void>> futures;
+	futures.reserve(count);
+
+	auto start = Clock::now();
+	for (int i = 0; i < count; ++i)
+		futures.push_back(spawn(pool, sleepy(pool, steps)));
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	size_t threads = processThreads();
+	for (auto &future : futures)
+		future.get();
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	std::cout << std::fixed << std::setprecision(2) << count << " coroutines x " << steps
+			  << " sleeps of 5 ms: " << seconds << " s (ideal " << steps * 0.005 << " s), "
+			  << threads << " threads" << std::endl;
+}
+
+static void pingPong(WorkerPool &pool, int pairs, int rounds) {
+	IoReactor reactor(pool);
+	std::vector<int> fds;
+	std::vector<Future<void>> futures;
+
+	auto start = Clock::now();
+	for (int i = 0; i < pairs; ++i) {
+		int sockets[2];
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) < 0)
+			break;
+		fds.push_back(sockets[0]);
+		fds.push_back(sockets[1]);
+		futures.push_back(spawn(pool, ponger(reactor, sockets[1], rounds)));
+		futures.push_back(spawn(pool, pinger(reactor, sockets[0], rounds)));
+	}
+	size_t threads = processThreads();
+	for (auto &future : futures)
+		future.get();
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	for (int fd : fds)
+		close(fd);
+
+	std::cout << std::fixed << std::setprecision(2) << fds.size() / 2 << " socket pairs x " << rounds
+			  << " round trips: " << seconds << " s, " << (fds.size() / 2) * rounds / seconds / 1e3
+			  << " k round trips/s, " << threads << " threads" << std::endl;
+}
+
+int main() {
+	WorkerPool pool(4);
+
+	sleepers(pool, 50000, 10);
+	pingPong(pool, 5000, 20);
+	return 0;
+}
+
+#else
+
+int main() {
+	std::cout << "Coroutine benchmark requires C++20 (make CXXSTD=c++20 bench)" << std::endl;
+	return 0;
+}
+
+#endif
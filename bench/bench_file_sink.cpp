@@ -0,0 +1,118 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <stdlib.h>
+#include "../libftpp.hpp"
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+/*
+** Throughput of file logging through a synchronous Logger: records/s and
+** MB/s from the first record until everything is in the file. The
+** baseline is the usual hand-written sink (ofstream, put_time and endl
+** per record); the FileSink runs use the default config, size rotation
+** with fallocate preallocation, and periodic fdatasync.
+*/
+class OfstreamSink : public Log::Sink
+{
+	public:
+		explicit OfstreamSink(const std::string &path) : _file(path, std::ios::app) {}
+		void write(const Log::Record &record) override {
+			std::time_t time = std::chrono::system_clock::to_time_t(record.timestamp);
+			std::tm calendar = *std::localtime(&time);
+			_file << std::put_time(&calendar, "%Y-%m-%d %H:%M:%S") << " [" << Log::levelName(record.level) << "] ["
+				  << record.loggerName << "] (" << record.source.file << ":" << record.source.line << ") - "
+				  << record.message << std::endl;
+		}
+		void flush() override { _file.flush(); }
+		void set_level(Log::LogLevel) override {}
+
+	private:
+		std::ofstream _file;
+};
+
+static uint64_t directorySize(const fs::path &dir) {
+	uint64_t total = 0;
+	for (const auto &entry : fs::directory_iterator(dir))
+		total += entry.file_size();
+	return total;
+}
+
+static void run(const char *label, const fs::path &dir, size_t producers, size_t records,
+				const std::function<Log::Sink *(const std::string &)> &open, const std::function<uint64_t(Log::Sink *, const fs::path &)> &finish) {
+	fs::remove_all(dir);
+	fs::create_directories(dir);
+	Log::Sink *sink = open((dir / "bench.log").string());
+	Log::Logger logger("bench");
+	logger.addSink(sink);
+	logger.setLogLevel(Log::LogLevel::INFO);
+	std::vector<std::thread> threads;
+
+	auto start = Clock::now();
+	for (size_t p = 0; p < producers; ++p) {
+		threads.emplace_back([&logger, records]() {
+			std::string message = "request served in 12 ms, status 200, bytes 5123, user 0000000";
+			for (size_t i = 0; i < records; ++i) {
+				message.replace(message.size() - 7, 7, std::to_string(1000000 + i % 9000000).substr(0, 7));
+				LOG_INFO(logger, message);
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	double bytes = static_cast<double>(finish(sink, dir));
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	logger.clearSinks();
+	delete sink;
+
+	std::cout << std::left << std::setw(28) << label << std::right << std::setw(2) << producers << " producers "
+			  << std::fixed << std::setprecision(2) << std::setw(7) << producers * records / seconds / 1e6 << " M records/s "
+			  << std::setprecision(0) << std::setw(6) << bytes / seconds / 1e6 << " MB/s" << std::endl;
+}
+
+int main() {
+	char pattern[] = "/tmp/libftpp_bench_file_sink_XXXXXX";
+	if (!mkdtemp(pattern))
+		return 1;
+	fs::path dir(pattern);
+	const size_t records = 500000;
+
+	auto openBaseline = [](const std::string &path) -> Log::Sink * { return new OfstreamSink(path); };
+	auto finishBaseline = [](Log::Sink *sink, const fs::path &dir) {
+		sink->flush();
+		return directorySize(dir);
+	};
+	auto openWith = [](Log::FileSink::Config config) {
+		return [config](const std::string &path) -> Log::Sink * { return new Log::FileSink(path, config); };
+	};
+	auto finishFileSink = [](Log::Sink *sink, const fs::path &) {
+		static_cast<Log::FileSink *>(sink)->sync();
+		return static_cast<Log::FileSink *>(sink)->bytesWritten();
+	};
+
+	Log::FileSink::Config defaults;
+	Log::FileSink::Config rotating;
+	rotating.rotateSize = 16 << 20;
+	rotating.preallocate = 16 << 20;
+	rotating.maxFiles = 10;
+	Log::FileSink::Config durable;
+	durable.fsync = Log::FsyncPolicy::PERIODIC;
+	durable.fsyncInterval = std::chrono::milliseconds(100);
+
+	for (size_t producers : {1, 4}) {
+		run("ofstream + endl", dir, producers, records, openBaseline, finishBaseline);
+		run("FileSink", dir, producers, records, openWith(defaults), finishFileSink);
+		run("FileSink, 16 MB rotation", dir, producers, records, openWith(rotating), finishFileSink);
+		run("FileSink, fdatasync 100 ms", dir, producers, records, openWith(durable), finishFileSink);
+	}
+	fs::remove_all(dir);
+	return 0;
+}
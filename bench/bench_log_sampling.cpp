@@ -0,0 +1,76 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <ctime>
+#include <functional>
+#include "../libftpp.hpp"
+
+static double threadCpuNanoseconds() {
+	struct timespec now;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+	return now.tv_sec * 1e9 + now.tv_nsec;
+}
+
+/*
+** Cost of a hot warning site during an incident: every call logged
+** through the Logger (sink lock, formatting, a sink that discards the
+** record) against LOG_EVERY_N(1000), LOG_FIRST_N(10) and
+** LOG_RATE_LIMITED(100/s), where nearly every call is suppressed. Time
+** is the calling threads' CPU time, averaged per call, so the figures
+** stay meaningful on machines with fewer cores than threads.
+*/
+class NullSink : public Log::Sink
+{
+	public:
+		void write(const Log::Record &) override {}
+		void flush() override {}
+		void set_level(Log::LogLevel) override {}
+};
+
+static void run(const char *label, size_t threads, size_t iterations, const std::function<void(size_t)> &statement) {
+	std::vector<std::thread> workers;
+	std::vector<double> nanoseconds(threads);
+
+	for (size_t t = 0; t < threads; ++t) {
+		workers.emplace_back([&, t]() {
+			double start = threadCpuNanoseconds();
+			for (size_t i = 0; i < iterations; ++i)
+				statement(i);
+			nanoseconds[t] = threadCpuNanoseconds() - start;
+		});
+	}
+	for (auto &worker : workers)
+		worker.join();
+
+	double total = 0;
+	for (double value : nanoseconds)
+		total += value;
+	std::cout << std::left << std::setw(24) << label << std::right << threads << " threads  " << std::fixed << std::setprecision(1)
+			  << std::setw(7) << total / (threads * iterations) << " ns/call" << std::endl;
+}
+
+int main() {
+	const size_t iterations = 2000000;
+	Log::Logger logger("bench");
+	NullSink sink;
+	logger.addSink(&sink);
+	logger.setLogLevel(Log::LogLevel::INFO);
+
+	for (size_t threads : {1, 4}) {
+		run("LOG_WARNING", threads, iterations / 10, [&logger](size_t i) {
+			LOG_WARNING(logger, "queue full, depth {}", i);
+		});
+		run("LOG_EVERY_N 1000", threads, iterations, [&logger](size_t i) {
+			LOG_EVERY_N(logger, WARNING, 1000, "queue full, depth {}", i);
+		});
+		run("LOG_FIRST_N 10", threads, iterations, [&logger](size_t i) {
+			LOG_FIRST_N(logger, WARNING, 10, "queue full, depth {}", i);
+		});
+		run("LOG_RATE_LIMITED 100/s", threads, iterations, [&logger](size_t i) {
+			LOG_RATE_LIMITED(logger, WARNING, 100, "queue full, depth {}", i);
+		});
+	}
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <memory>
+#include "../libftpp.hpp"
+
+/*
+** Caller-side latency of LOG_INFO, measured per call with CycleClock, for a
+** synchronous Logger and for async mode with the default (BLOCK) and
+** DROP_NEWEST overflow policies. The sink either discards records or
+** sleeps 1 us every 64 records to model a slow destination. Messages
+** are short enough to fit the small-string buffer so the figure is the
+** logger's cost, not the allocator's. Figures include one CycleClock read,
+** whose own cost is printed first. Async callers should stay flat while
+** the sink is slow, except under BLOCK once the ring is full.
+*/
+class NullSink : public Log::Sink
+{
+	public:
+		explicit NullSink(std::chrono::microseconds delay) : _delay(delay) {}
+		void write(const Log::Record &) override {
+			if (_delay.count() && ++_written % 64 == 0)
+				std::this_thread::sleep_for(_delay);
+		}
+		void flush() override {}
+		void set_level(Log::LogLevel) override {}
+
+	private:
+		std::chrono::microseconds _delay;
+		size_t _written = 0;
+};
+
+static void run(const char *label, bool async, Log::OverflowPolicy overflow, std::chrono::microseconds delay,
+				size_t producers, size_t records) {
+	Log::Logger logger("bench");
+	NullSink sink(delay);
+	logger.addSink(&sink);
+	logger.setLogLevel(Log::LogLevel::INFO);
+	if (async) {
+		Log::AsyncConfig config;
+		config.overflow = overflow;
+		logger.startAsync(config);
+	}
+
+	std::vector<std::unique_ptr<LatencyHistogram>> histograms;
+	std::vector<std::thread> threads;
+	for (size_t p = 0; p < producers; ++p)
+		histograms.push_back(std::make_unique<LatencyHistogram>());
+	std::string message = "request served";
+	for (size_t p = 0; p < producers; ++p) {
+		threads.emplace_back([&logger, &message, &histograms, p, records]() {
+			LatencyHistogram &histogram = *histograms[p];
+			for (size_t i = 0; i < records; ++i) {
+				uint64_t start = CycleClock::now();
+				LOG_INFO(logger, message);
+				histogram.record(CycleClock::now() - start);
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	logger.flush();
+
+	LatencyHistogram::Snapshot total = histograms[0]->snapshot(CycleClock::ticksPerNanosecond());
+	for (size_t p = 1; p < producers; ++p)
+		total.merge(histograms[p]->snapshot(CycleClock::ticksPerNanosecond()));
+	std::cout << std::left << std::setw(26) << label << std::right << std::setw(2) << producers << " producers  "
+			  << std::fixed << std::setprecision(0)
+			  << "p50 " << std::setw(6) << total.percentile(0.5)
+			  << "  p99 " << std::setw(6) << total.percentile(0.99)
+			  << "  p99.9 " << std::setw(7) << total.percentile(0.999) << " ns"
+			  << "  dropped " << logger.droppedRecords() << std::endl;
+}
+
+static double clockOverhead(size_t iterations) {
+	LatencyHistogram histogram;
+
+	for (size_t i = 0; i < iterations; ++i) {
+		uint64_t start = CycleClock::now();
+		histogram.record(CycleClock::now() - start);
+	}
+	return histogram.snapshot(CycleClock::ticksPerNanosecond()).percentile(0.5);
+}
+
+int main() {
+	const size_t records = 200000;
+	const std::chrono::microseconds none(0);
+	const std::chrono::microseconds slow(1);
+
+	std::cout << std::fixed << std::setprecision(0) << "CycleClock read overhead (p50): " << clockOverhead(1000000) << " ns" << std::endl;
+	for (size_t producers : {1, 4}) {
+		run("sync, null sink", false, Log::OverflowPolicy::BLOCK, none, producers, records);
+		run("async block, null sink", true, Log::OverflowPolicy::BLOCK, none, producers, records);
+		run("async block, slow sink", true, Log::OverflowPolicy::BLOCK, slow, producers, records);
+		run("async drop, slow sink", true, Log::OverflowPolicy::DROP_NEWEST, slow, producers, records);
+	}
+	return 0;
+}
@@ -0,0 +1,49 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** Cost of a log statement below the logger's level: LOG_DEBUG, which
+** checks the level before building its message, against calling log()
+** directly with an eagerly built message. Each thread runs the statement
+** in a tight loop; 4 threads show whether the check contends.
+*/
+template <typename TStatement>
+static double perCall(size_t threadCount, size_t iterations, TStatement statement) {
+	std::vector<std::thread> threads;
+
+	auto start = Clock::now();
+	for (size_t t = 0; t < threadCount; ++t) {
+		threads.emplace_back([&statement, iterations]() {
+			for (size_t i = 0; i < iterations; ++i)
+				statement(i);
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (threadCount * iterations);
+}
+
+int main() {
+	Log::Logger logger("bench");
+	logger.setLogLevel(Log::LogLevel::WARNING);
+	const size_t iterations = 20000000;
+
+	for (size_t threads : {1, 4}) {
+		double lazy = perCall(threads, iterations, [&logger](size_t i) {
+			LOG_DEBUG(logger, "cache miss for key " + std::to_string(i));
+		});
+		double eager = perCall(threads, iterations / 20, [&logger](size_t i) {
+			logger.log(Log::LogLevel::DEBUG, "cache miss for key " + std::to_string(i), Log::Source{__FILE__, __LINE__, __func__});
+		});
+		std::cout << std::fixed << std::setprecision(2) << threads << " threads: LOG_DEBUG " << lazy
+				  << " ns/call, eager log() " << eager << " ns/call" << std::endl;
+	}
+	return 0;
+}
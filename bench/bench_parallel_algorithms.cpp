@@ -0,0 +1,68 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <random>
+#include <cmath>
+#include <chrono>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+template <typename TFunction>
+static double timeMs(TFunction function) {
+	auto start = Clock::now();
+	function();
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+int main() {
+	const size_t count = 10000000;
+	std::vector<double> input(count);
+	std::vector<double> output(count);
+	std::mt19937 generator(7);
+	std::uniform_real_distribution<double> distribution(0.0, 1000.0);
+	for (auto &value : input)
+		value = distribution(generator);
+
+	auto work = [](double v) { return std::sqrt(v) * std::sin(v); };
+	std::vector<double> unsorted = input;
+
+	std::cout << std::fixed << std::setprecision(1) << count << " doubles, times in ms" << std::endl;
+	std::cout << std::setw(12) << "algorithm" << std::setw(10) << "serial";
+	unsigned int maxWorkers = std::max(1u, std::thread::hardware_concurrency());
+	for (unsigned int workers = 1; workers <= maxWorkers; workers *= 2)
+		std::cout << std::setw(8) << workers << "w";
+	std::cout << std::endl;
+
+	std::vector<std::pair<std::string, std::vector<double>>> rows = {
+		{"for", {}}, {"reduce", {}}, {"transform", {}}, {"scan", {}}, {"sort", {}}
+	};
+	volatile double sink = 0;
+
+	rows[0].second.push_back(timeMs([&]() { for (size_t i = 0; i < count; ++i) output[i] = work(input[i]); }));
+	rows[1].second.push_back(timeMs([&]() { sink = std::accumulate(input.begin(), input.end(), 0.0); }));
+	rows[2].second.push_back(timeMs([&]() { std::transform(input.begin(), input.end(), output.begin(), work); }));
+	rows[3].second.push_back(timeMs([&]() { std::partial_sum(input.begin(), input.end(), output.begin()); }));
+	rows[4].second.push_back(timeMs([&]() { std::vector<double> data = unsorted; std::sort(data.begin(), data.end()); }));
+
+	for (unsigned int workers = 1; workers <= maxWorkers; workers *= 2) {
+		WorkerPool pool(workers);
+		rows[0].second.push_back(timeMs([&]() { parallelFor(pool, size_t(0), count, [&](size_t i) { output[i] = work(input[i]); }); }));
+		rows[1].second.push_back(timeMs([&]() { sink = parallelReduce(pool, input.begin(), input.end(), 0.0); }));
+		rows[2].second.push_back(timeMs([&]() { parallelTransform(pool, input.begin(), input.end(), output.begin(), work); }));
+		rows[3].second.push_back(timeMs([&]() { parallelScan(pool, input.begin(), input.end(), output.begin()); }));
+		rows[4].second.push_back(timeMs([&]() { std::vector<double> data = unsorted; parallelSort(pool, data.begin(), data.end()); }));
+	}
+	(void)sink;
+
+	for (auto &row : rows) {
+		std::cout << std::setw(12) << row.first;
+		std::cout << std::setw(10) << row.second[0];
+		for (size_t i = 1; i < row.second.size(); ++i)
+			std::cout << std::setw(9) << row.second[i];
+		std::cout << std::endl;
+	}
+	return 0;
+}
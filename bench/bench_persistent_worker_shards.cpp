@@ -0,0 +1,87 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** 1000 tasks at a 10 ms period, each spinning ~2 us, plus two 2 ms
+** tasks. Runs them on one PersistentWorker and on sharded workers,
+** then reports per-task mean jitter (p50/p99 across tasks), the worst
+** single jitter and the total overruns.
+*/
+static const size_t TaskCount = 1000;
+static const size_t SlowTasks = 2;
+
+static void spin(std::chrono::microseconds length) {
+	auto until = Clock::now() + length;
+	while (Clock::now() < until)
+		;
+}
+
+static std::function<void()> workFor(size_t index) {
+	auto length = index < SlowTasks ? std::chrono::microseconds(2000) : std::chrono::microseconds(2);
+	return [length]() { spin(length); };
+}
+
+template <typename TWorker>
+static void report(const std::string &label, const TWorker &worker) {
+	std::vector<double> meanJitter;
+	double maxJitter = 0.0;
+	uint64_t overruns = 0;
+	uint64_t runs = 0;
+	meanJitter.reserve(TaskCount);
+
+	for (size_t i = 0; i < TaskCount; ++i) {
+		auto stats = worker.getStats("task" + std::to_string(i));
+		meanJitter.push_back(std::chrono::duration<double, std::micro>(stats.meanJitter).count());
+		maxJitter = std::max(maxJitter, std::chrono::duration<double, std::micro>(stats.maxJitter).count());
+		overruns += stats.overruns;
+		runs += stats.runs;
+	}
+	std::sort(meanJitter.begin(), meanJitter.end());
+	std::cout << std::fixed << std::setprecision(1)
+			  << label << ": " << runs << " runs, " << overruns << " overruns"
+			  << ", mean jitter p50 " << meanJitter[TaskCount / 2] << " us"
+			  << ", p99 " << meanJitter[TaskCount * 99 / 100] << " us"
+			  << ", max " << maxJitter << " us" << std::endl;
+}
+
+static void single(std::chrono::milliseconds runFor) {
+	PersistentWorker worker;
+
+	for (size_t i = 0; i < TaskCount; ++i)
+		worker.addTask("task" + std::to_string(i), std::chrono::milliseconds(10), workFor(i));
+	std::this_thread::sleep_for(runFor);
+	report("PersistentWorker (1 thread)", worker);
+}
+
+static void sharded(size_t shards, std::chrono::milliseconds runFor, bool rebalance) {
+	ShardedPersistentWorker worker(shards);
+
+	for (size_t i = 0; i < TaskCount; ++i)
+		worker.addTask("task" + std::to_string(i), std::chrono::milliseconds(10), workFor(i));
+	if (rebalance) {
+		std::this_thread::sleep_for(runFor / 4);
+		size_t moved = worker.rebalance();
+		std::cout << "  rebalance moved " << moved << " tasks" << std::endl;
+		std::this_thread::sleep_for(runFor);
+	} else
+		std::this_thread::sleep_for(runFor);
+	report("ShardedPersistentWorker (" + std::to_string(shards) + " shards"
+		   + (rebalance ? ", rebalanced)" : ")"), worker);
+}
+
+int main() {
+	std::chrono::milliseconds runFor(2000);
+
+	single(runFor);
+	sharded(4, runFor, false);
+	sharded(4, runFor, true);
+	return 0;
+}
@@ -0,0 +1,104 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+// Busy work standing in for a pipeline stage on one client
+static void burn(std::chrono::microseconds duration) {
+	auto end = Clock::now() + duration;
+	while (Clock::now() < end)
+		;
+}
+
+struct Frame {
+	std::vector<std::chrono::microseconds> decode;
+	std::vector<std::chrono::microseconds> update;
+	std::vector<std::chrono::microseconds> snapshot;
+	std::chrono::microseconds broadcast;
+
+	std::chrono::microseconds totalWork() const {
+		std::chrono::microseconds total = broadcast;
+		for (size_t i = 0; i < decode.size(); ++i)
+			total += decode[i] + update[i] + snapshot[i];
+		return total;
+	}
+};
+
+static Frame makeFrame(size_t clients) {
+	std::mt19937 generator(1);
+	std::uniform_int_distribution<int> uneven(20, 400);
+	Frame frame;
+	for (size_t i = 0; i < clients; ++i) {
+		frame.decode.emplace_back(uneven(generator));
+		frame.update.emplace_back(uneven(generator));
+		frame.snapshot.emplace_back(uneven(generator));
+	}
+	frame.broadcast = std::chrono::microseconds(100);
+	return frame;
+}
+
+int main() {
+	const size_t clients = 32;
+	const int frames = 50;
+	Frame frame = makeFrame(clients);
+	unsigned int workers = std::max(2u, std::thread::hardware_concurrency());
+	double workMs = frame.totalWork().count() / 1000.0;
+
+	std::cout << clients << " clients per frame, " << workers << " workers, " << std::fixed << std::setprecision(2)
+			  << workMs << " ms of work per frame" << std::endl;
+
+	// 1. Hand-serialized on the calling thread
+	auto start = Clock::now();
+	for (int f = 0; f < frames; ++f) {
+		for (auto d : frame.decode) burn(d);
+		for (auto u : frame.update) burn(u);
+		for (auto s : frame.snapshot) burn(s);
+		burn(frame.broadcast);
+	}
+	double serialMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+
+	WorkerPool pool(workers);
+
+	// 2. Stage by stage on the pool with a barrier between stages
+	start = Clock::now();
+	for (int f = 0; f < frames; ++f) {
+		for (auto d : frame.decode) pool.addJob([d]() { burn(d); });
+		pool.waitAll();
+		for (auto u : frame.update) pool.addJob([u]() { burn(u); });
+		pool.waitAll();
+		for (auto s : frame.snapshot) pool.addJob([s]() { burn(s); });
+		pool.waitAll();
+		burn(frame.broadcast);
+	}
+	double barrierMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+
+	// 3. TaskGraph: each client's chain proceeds as soon as its own input is ready
+	TaskGraph graph;
+	TaskGraph::NodeId broadcast = graph.addNode("broadcast", [&frame]() { burn(frame.broadcast); });
+	for (size_t i = 0; i < clients; ++i) {
+		TaskGraph::NodeId decode = graph.addNode("decode", [&frame, i]() { burn(frame.decode[i]); });
+		TaskGraph::NodeId update = graph.addNode("update", [&frame, i]() { burn(frame.update[i]); });
+		TaskGraph::NodeId snapshot = graph.addNode("snapshot", [&frame, i]() { burn(frame.snapshot[i]); });
+		graph.addDependency(update, decode);
+		graph.addDependency(snapshot, update);
+		graph.addDependency(broadcast, snapshot);
+	}
+	start = Clock::now();
+	for (int f = 0; f < frames; ++f)
+		graph.runAndWait(pool);
+	double graphMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+
+	auto report = [&](const char *name, double ms, unsigned int threads) {
+		std::cout << std::setw(20) << name << ": " << std::setw(8) << ms << " ms/frame, utilization "
+				  << std::setprecision(1) << 100.0 * workMs / (ms * threads) << "%" << std::setprecision(2) << std::endl;
+	};
+	report("serialized", serialMs, 1);
+	report("stage barriers", barrierMs, workers);
+	report("TaskGraph", graphMs, workers);
+	return 0;
+}
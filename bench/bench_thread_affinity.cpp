@@ -0,0 +1,76 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** Cache-sensitive workload: every job walks a per-worker 256 KB working set
+** that fits in L2. Waves of jobs are separated by short sleeps so unpinned
+** workers get migrated between cores and come back to a cold cache.
+*/
+static const size_t WORKING_SET = 256 * 1024 / sizeof(uint64_t);
+static const int WAVES = 400;
+static const auto WAVE_GAP = std::chrono::microseconds(500);
+
+static uint64_t walk(std::vector<uint64_t> &data) {
+	uint64_t sum = 0;
+	for (int pass = 0; pass < 4; ++pass) {
+		for (size_t i = 0; i < data.size(); i += 8) {
+			data[i] += pass;
+			sum += data[i];
+		}
+	}
+	return sum;
+}
+
+static void run(const char *name, bool pin) {
+	size_t workers = ThreadAttributes::availableCpus().size();
+	WorkerPool::Config config;
+	config.pinWorkers = pin;
+	config.workerAttributes.name = "affinity";
+	WorkerPool pool(workers, config);
+
+	std::vector<double> timings;
+	std::mutex timingMutex;
+	std::atomic<uint64_t> checksum{0};
+	timings.reserve(WAVES * workers);
+
+	for (int wave = 0; wave < WAVES; ++wave) {
+		for (size_t job = 0; job < workers; ++job) {
+			pool.addJob([&]() {
+				thread_local std::vector<uint64_t> data(WORKING_SET, 1);
+				auto start = Clock::now();
+				checksum.fetch_add(walk(data), std::memory_order_relaxed);
+				double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+				std::lock_guard<std::mutex> lock(timingMutex);
+				timings.push_back(micros);
+			});
+		}
+		pool.waitAll();
+		std::this_thread::sleep_for(WAVE_GAP);
+	}
+
+	std::sort(timings.begin(), timings.end());
+	double mean = std::accumulate(timings.begin(), timings.end(), 0.0) / timings.size();
+	std::cout << std::left << std::setw(10) << name << std::right << std::fixed << std::setprecision(1)
+			  << " mean " << std::setw(7) << mean << " us"
+			  << "  p50 " << std::setw(7) << timings[timings.size() / 2] << " us"
+			  << "  p99 " << std::setw(7) << timings[timings.size() * 99 / 100] << " us"
+			  << "  (checksum " << checksum.load() << ")" << std::endl;
+}
+
+int main() {
+	std::cout << ThreadAttributes::availableCpus().size() << " CPUs, " << WAVES
+			  << " waves of one 256 KB walk per worker" << std::endl;
+	run("floating", false);
+	run("pinned", true);
+	return 0;
+}
@@ -0,0 +1,116 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** Per-line cost of threadSafeCout against a copy of the previous
+** implementation (ostringstream per operator<<, char-by-char prefix
+** insertion). std::cout is redirected to a discarding streambuf so the
+** numbers measure formatting and locking, not the terminal.
+*/
+class NullBuffer : public std::streambuf
+{
+	protected:
+		std::streamsize xsputn(const char *, std::streamsize count) override { return count; }
+		int overflow(int c) override { return c; }
+};
+
+class LegacyStream
+{
+	public:
+		void setPrefix(const std::string &prefix) { _prefix = prefix; }
+
+		template <typename T>
+		LegacyStream &operator<<(const T &value) {
+			std::ostringstream oss;
+			oss << value;
+			std::string text = oss.str();
+			_buffer += text;
+			return *this;
+		}
+
+		LegacyStream &operator<<(std::ostream &(*manip)(std::ostream &)) {
+			std::lock_guard<std::mutex> lock(_mutex);
+			std::string full_content = _buffer;
+			_buffer.clear();
+			if (!full_content.empty())
+				std::cout << format(full_content);
+			std::cout << manip;
+			std::cout.flush();
+			_line_start = true;
+			return *this;
+		}
+
+	private:
+		bool _line_start = true;
+		std::string _prefix;
+		static std::mutex _mutex;
+		static thread_local std::string _buffer;
+
+		std::string format(const std::string &text) {
+			std::string result;
+			bool need_prefix = _line_start;
+			for (char c : text) {
+				if (need_prefix) {
+					result += _prefix;
+					need_prefix = false;
+				}
+				result += c;
+				if (c == '\n')
+					need_prefix = true;
+			}
+			return result;
+		}
+};
+
+std::mutex LegacyStream::_mutex;
+thread_local std::string LegacyStream::_buffer;
+static thread_local LegacyStream legacyCout;
+
+template <typename TStream>
+static void writeLines(TStream &stream, int worker, size_t lines) {
+	stream.setPrefix("[worker " + std::to_string(worker) + "] ");
+	for (size_t i = 0; i < lines; ++i)
+		stream << "job " << i << " took " << 12.5 + i % 7 << " ms, ok=" << (i % 3 != 0) << std::endl;
+}
+
+template <typename TFunction>
+static double nsPerLine(size_t threadCount, size_t lines, TFunction body) {
+	std::vector<std::thread> threads;
+
+	auto start = Clock::now();
+	for (size_t t = 0; t < threadCount; ++t)
+		threads.emplace_back(body, static_cast<int>(t), lines);
+	for (auto &thread : threads)
+		thread.join();
+	return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (threadCount * lines);
+}
+
+int main() {
+	const size_t lines = 200000;
+	NullBuffer discard;
+	std::streambuf *console = std::cout.rdbuf(&discard);
+	std::vector<std::pair<size_t, std::pair<double, double>>> results;
+
+	for (size_t threads : {1, 4}) {
+		double legacy = nsPerLine(threads, lines, [](int worker, size_t count) { writeLines(legacyCout, worker, count); });
+		double current = nsPerLine(threads, lines, [](int worker, size_t count) { writeLines(threadSafeCout, worker, count); });
+		results.push_back({threads, {legacy, current}});
+	}
+	std::cout.rdbuf(console);
+
+	std::cout << std::fixed << std::setprecision(1);
+	for (const auto &result : results)
+		std::cout << result.first << " thread(s): previous " << result.second.first << " ns/line, "
+				  << "current " << result.second.second << " ns/line ("
+				  << result.second.first / result.second.second << "x)" << std::endl;
+	return 0;
+}
@@ -0,0 +1,91 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** Caller-side cost per line of threadSafeCout in SYNC and ASYNC mode, with
+** stdout pointed at /dev/null and at a pipe whose reader is slow (reads
+** 4 KB every 50 us). The ASYNC figure excludes the final flush, which is
+** reported separately: it is the time workers no longer spend blocked.
+*/
+struct Result
+{
+	double nsPerLine;
+	double drainMs;
+};
+
+static Result run(ThreadSafeIOStream::OutputMode mode, size_t threadCount, size_t lines) {
+	std::vector<std::thread> threads;
+
+	ThreadSafeIOStream::setOutputMode(mode);
+	auto start = Clock::now();
+	for (size_t t = 0; t < threadCount; ++t) {
+		threads.emplace_back([t, lines]() {
+			threadSafeCout.setPrefix("[worker " + std::to_string(t) + "] ");
+			for (size_t i = 0; i < lines; ++i)
+				threadSafeCout << "job " << i << " took " << 12.5 + i % 7 << " ms" << std::endl;
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	auto produced = Clock::now();
+	ThreadSafeIOStream::setOutputMode(ThreadSafeIOStream::OutputMode::SYNC);
+	auto drained = Clock::now();
+
+	return {std::chrono::duration<double, std::nano>(produced - start).count() / (threadCount * lines),
+			std::chrono::duration<double, std::milli>(drained - produced).count()};
+}
+
+template <typename TFunction>
+static Result withStdout(int fd, TFunction body) {
+	std::cout.flush();
+	int saved = dup(STDOUT_FILENO);
+	dup2(fd, STDOUT_FILENO);
+	Result result = body();
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+	return result;
+}
+
+static void report(const std::string &label, const Result &result) {
+	std::cout << std::fixed << std::setprecision(1) << "  " << std::left << std::setw(6) << label << std::right
+			  << result.nsPerLine << " ns/line in callers, " << result.drainMs << " ms to drain" << std::endl;
+}
+
+int main() {
+	const size_t threads = 4;
+	const size_t lines = 100000;
+	int devNull = open("/dev/null", O_WRONLY);
+
+	std::cout << "/dev/null, " << threads << " threads x " << lines << " lines" << std::endl;
+	report("SYNC", withStdout(devNull, [&]() { return run(ThreadSafeIOStream::OutputMode::SYNC, threads, lines); }));
+	report("ASYNC", withStdout(devNull, [&]() { return run(ThreadSafeIOStream::OutputMode::ASYNC, threads, lines); }));
+	close(devNull);
+
+	const size_t pipeLines = 10000;
+	std::cout << "slow pipe reader, " << threads << " threads x " << pipeLines << " lines" << std::endl;
+	for (auto mode : {ThreadSafeIOStream::OutputMode::SYNC, ThreadSafeIOStream::OutputMode::ASYNC}) {
+		int fds[2];
+		if (pipe(fds) != 0)
+			return 1;
+		std::thread reader([&]() {
+			char chunk[4096];
+			while (read(fds[0], chunk, sizeof(chunk)) > 0)
+				std::this_thread::sleep_for(std::chrono::microseconds(50));
+		});
+		Result result = withStdout(fds[1], [&]() { return run(mode, threads, pipeLines); });
+		close(fds[1]);
+		reader.join();
+		close(fds[0]);
+		report(mode == ThreadSafeIOStream::OutputMode::SYNC ? "SYNC" : "ASYNC", result);
+	}
+	return 0;
+}
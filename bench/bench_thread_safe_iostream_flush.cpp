@@ -0,0 +1,110 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** 1M lines through threadSafeCout with stdout redirected to a regular
+** file and to a pipe drained by a reader thread, under each flush policy.
+** write(2) calls are counted from /proc/self/io (syscw); the pipe reader
+** only reads, so the count is the output path's alone.
+*/
+static uint64_t writeSyscalls() {
+	std::ifstream io("/proc/self/io");
+	std::string key;
+	uint64_t value = 0;
+
+	while (io >> key >> value) {
+		if (key == "syscw:")
+			return value;
+	}
+	return 0;
+}
+
+struct Result
+{
+	double linesPerSecond;
+	uint64_t syscalls;
+};
+
+static Result run(const ThreadSafeIOStream::FlushPolicy &policy, int fd, size_t lines) {
+	std::cout.flush();
+	int saved = dup(STDOUT_FILENO);
+	dup2(fd, STDOUT_FILENO);
+	ThreadSafeIOStream::setFlushPolicy(policy);
+	threadSafeCout.setPrefix("[bench] ");
+
+	uint64_t before = writeSyscalls();
+	auto start = Clock::now();
+	for (size_t i = 0; i < lines; ++i)
+		threadSafeCout << "line " << i << " value " << i * 0.5 << std::endl;
+	ThreadSafeIOStream::flush();
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	uint64_t syscalls = writeSyscalls() - before;
+
+	threadSafeCout.setPrefix("");
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+	return {lines / seconds, syscalls};
+}
+
+static const char *name(ThreadSafeIOStream::FlushMode mode) {
+	switch (mode) {
+		case ThreadSafeIOStream::FlushMode::LINE: return "LINE";
+		case ThreadSafeIOStream::FlushMode::INTERVAL: return "INTERVAL 50ms";
+		case ThreadSafeIOStream::FlushMode::SIZE: return "SIZE 64KB";
+		case ThreadSafeIOStream::FlushMode::EXIT: return "EXIT";
+	}
+	return "";
+}
+
+int main() {
+	const size_t lines = 1000000;
+	ThreadSafeIOStream::FlushPolicy original = ThreadSafeIOStream::getFlushPolicy();
+	std::vector<ThreadSafeIOStream::FlushMode> modes = {
+		ThreadSafeIOStream::FlushMode::LINE, ThreadSafeIOStream::FlushMode::INTERVAL,
+		ThreadSafeIOStream::FlushMode::SIZE, ThreadSafeIOStream::FlushMode::EXIT};
+
+	std::cout << "suggested policy for this stdout: " << name(ThreadSafeIOStream::stdoutFlushPolicy().mode) << std::endl;
+	std::cout << std::fixed << std::setprecision(0);
+	for (int target = 0; target < 2; ++target) {
+		std::cout << (target == 0 ? "regular file" : "pipe") << ", " << lines << " lines" << std::endl;
+		for (auto mode : modes) {
+			ThreadSafeIOStream::FlushPolicy policy;
+			policy.mode = mode;
+			Result result;
+
+			if (target == 0) {
+				FILE *file = std::tmpfile();
+				result = run(policy, fileno(file), lines);
+				std::fclose(file);
+			} else {
+				int fds[2];
+				if (pipe(fds) != 0)
+					return 1;
+				std::thread reader([&]() {
+					char chunk[65536];
+					while (read(fds[0], chunk, sizeof(chunk)) > 0)
+						;
+				});
+				result = run(policy, fds[1], lines);
+				close(fds[1]);
+				reader.join();
+				close(fds[0]);
+			}
+			std::cout << "  " << std::left << std::setw(14) << name(mode) << std::right
+					  << std::setw(9) << result.syscalls << " write calls, "
+					  << std::setw(9) << result.linesPerSecond << " lines/s" << std::endl;
+		}
+	}
+	ThreadSafeIOStream::setFlushPolicy(original);
+	return 0;
+}
@@ -0,0 +1,90 @@
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include "../libftpp.hpp"
+
+using SystemClock = std::chrono::system_clock;
+using Clock = std::chrono::steady_clock;
+
+/*
+** Timestamp formats per second for "YYYY-MM-DD HH:MM:SS.mmm", the way log
+** sinks produce it: put_time into an ostringstream, localtime_r with
+** strftime on every call, and TimestampFormatter::perThread(). Timestamps
+** advance 1 us per call, like a busy logger's records. glibc's localtime
+** takes a process-wide lock, so the per-call variants also stop scaling
+** with threads.
+*/
+static void run(const char *label, size_t threads, size_t iterations,
+				const std::function<size_t(SystemClock::time_point, std::string &)> &format) {
+	std::vector<std::thread> workers;
+	std::vector<size_t> lengths(threads);
+	SystemClock::time_point base = SystemClock::now();
+
+	auto start = Clock::now();
+	for (size_t t = 0; t < threads; ++t) {
+		workers.emplace_back([&, t]() {
+			std::string text;
+			size_t total = 0;
+			for (size_t i = 0; i < iterations; ++i) {
+				text.clear();
+				total += format(base + std::chrono::microseconds(i), text);
+			}
+			lengths[t] = total;
+		});
+	}
+	for (auto &worker : workers)
+		worker.join();
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	size_t expected = 0;
+	for (size_t length : lengths)
+		expected += length;
+	std::cout << std::left << std::setw(28) << label << std::right << threads << " threads  " << std::fixed << std::setprecision(1)
+			  << std::setw(7) << threads * iterations / seconds / 1e6 << " M formats/s"
+			  << (expected == threads * iterations * 23 ? "" : "  (wrong length)") << std::endl;
+}
+
+static int millisOf(SystemClock::time_point time) {
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(time.time_since_epoch()).count() % 1000);
+}
+
+int main() {
+	const size_t iterations = 1000000;
+
+	auto putTime = [](SystemClock::time_point time, std::string &out) {
+		std::time_t seconds = SystemClock::to_time_t(time);
+		struct tm calendar;
+		localtime_r(&seconds, &calendar);
+		std::ostringstream stream;
+		stream << std::put_time(&calendar, "%Y-%m-%d %H:%M:%S") << '.' << std::setw(3) << std::setfill('0') << millisOf(time);
+		out = stream.str();
+		return out.size();
+	};
+	auto strftimeEach = [](SystemClock::time_point time, std::string &out) {
+		std::time_t seconds = SystemClock::to_time_t(time);
+		struct tm calendar;
+		char text[32];
+		localtime_r(&seconds, &calendar);
+		size_t length = std::strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &calendar);
+		length += std::snprintf(text + length, sizeof(text) - length, ".%03d", millisOf(time));
+		out.append(text, length);
+		return out.size();
+	};
+	auto cached = [](SystemClock::time_point time, std::string &out) {
+		TimestampFormatter::perThread().append(out, time);
+		return out.size();
+	};
+
+	for (size_t threads : {1, 4}) {
+		run("put_time + ostringstream", threads, iterations, putTime);
+		run("localtime_r + strftime", threads, iterations, strftimeEach);
+		run("TimestampFormatter", threads, iterations, cached);
+	}
+	return 0;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static std::atomic<size_t> g_allocations{0};
+
+void *operator new(size_t size) {
+	g_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (void *memory = std::malloc(size ? size : 1))
+		return memory;
+	throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept {
+	std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+	std::free(memory);
+}
+
+class CounterJob : public WorkerPool::IJobs {
+	public:
+		explicit CounterJob(std::atomic<long> &counter) : _counter(counter) {}
+		void execute() override { _counter.fetch_add(1, std::memory_order_relaxed); }
+
+	private:
+		std::atomic<long> &_counter;
+};
+
+template <typename TSubmit>
+static void run(const char *name, WorkerPool &pool, size_t submits, size_t jobsPerSubmit, TSubmit submit) {
+	size_t jobs = submits * jobsPerSubmit;
+	// Warm-up fills the per-thread node caches
+	for (size_t i = 0; i < submits / 10; ++i)
+		submit(i);
+	pool.waitAll();
+
+	size_t before = g_allocations.load();
+	auto start = Clock::now();
+	for (size_t i = 0; i < submits; ++i)
+		submit(i);
+	pool.waitAll();
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	size_t allocations = g_allocations.load() - before;
+
+	std::cout << std::setw(26) << name << ": " << std::fixed << std::setprecision(2)
+			  << jobs / seconds / 1e6 << " M jobs/s, " << std::setprecision(4)
+			  << static_cast<double>(allocations) / jobs << " allocations/job" << std::endl;
+}
+
+int main() {
+	const size_t jobs = 2000000;
+	WorkerPool pool(std::max(2u, std::thread::hardware_concurrency()));
+	std::atomic<long> counter{0};
+	double payload[4] = {1.0, 2.0, 3.0, 4.0};
+
+	run("lambda (8-byte capture)", pool, jobs, 1, [&](size_t) {
+		pool.addJob([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+	});
+	run("lambda (48-byte capture)", pool, jobs, 1, [&](size_t i) {
+		pool.addJob([&counter, payload, i]() { counter.fetch_add(static_cast<long>(payload[i % 4]), std::memory_order_relaxed); });
+	});
+	run("std::function", pool, jobs, 1, [&](size_t) {
+		static const std::function<void()> function = [&counter]() { counter.fetch_add(1, std::memory_order_relaxed); };
+		pool.addJob(function);
+	});
+	run("unique_ptr<IJobs>", pool, jobs, 1, [&](size_t) {
+		pool.addJob(std::unique_ptr<WorkerPool::IJobs>(new CounterJob(counter)));
+	});
+	run("nested from worker", pool, jobs / 1000, 1001, [&](size_t) {
+		pool.addJob([&pool, &counter]() {
+			for (int i = 0; i < 1000; ++i)
+				pool.addJob([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+		});
+	});
+	return 0;
+}
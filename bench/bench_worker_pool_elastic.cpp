@@ -0,0 +1,99 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** Bursty I/O-style load: every 200 ms a burst of blocking 1 ms jobs is
+** submitted, followed by a quiet tail. Reports submit-to-start latency and
+** samples the pool size every 50 ms.
+*/
+static const int BURSTS = 8;
+static const int JOBS_PER_BURST = 120;
+static const auto BURST_PERIOD = std::chrono::milliseconds(200);
+static const auto JOB_DURATION = std::chrono::milliseconds(1);
+static const auto QUIET_TAIL = std::chrono::milliseconds(1200);
+
+static double percentile(const std::vector<double> &sorted, double p) {
+	return sorted[std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()))];
+}
+
+static void run(const char *name, size_t initial, const WorkerPool::Config &config) {
+	WorkerPool pool(initial, config);
+	std::vector<double> latencies;
+	std::mutex latencyMutex;
+	std::vector<size_t> sizes;
+	std::atomic<bool> sampling{true};
+	latencies.reserve(BURSTS * JOBS_PER_BURST);
+
+	std::thread sampler([&]() {
+		while (sampling.load()) {
+			sizes.push_back(pool.size());
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		}
+	});
+
+	for (int burst = 0; burst < BURSTS; ++burst) {
+		auto burstStart = Clock::now();
+		for (int i = 0; i < JOBS_PER_BURST; ++i) {
+			auto submitted = Clock::now();
+			pool.addJob([&, submitted]() {
+				double waited = std::chrono::duration<double, std::milli>(Clock::now() - submitted).count();
+				{
+					std::lock_guard<std::mutex> lock(latencyMutex);
+					latencies.push_back(waited);
+				}
+				std::this_thread::sleep_for(JOB_DURATION);
+			});
+		}
+		std::this_thread::sleep_until(burstStart + BURST_PERIOD);
+	}
+	pool.waitAll();
+	std::this_thread::sleep_for(QUIET_TAIL);
+	sampling.store(false);
+	sampler.join();
+
+	std::sort(latencies.begin(), latencies.end());
+	WorkerPool::Stats stats = pool.stats();
+	double averageSize = 0;
+	std::string timeline;
+	for (size_t size : sizes) {
+		averageSize += size;
+		timeline += std::to_string(size) + " ";
+	}
+	averageSize /= std::max<size_t>(1, sizes.size());
+
+	std::cout << std::left << std::setw(18) << name << std::right << std::fixed << std::setprecision(2)
+			  << " p50 " << std::setw(7) << percentile(latencies, 0.50) << " ms"
+			  << "  p99 " << std::setw(7) << percentile(latencies, 0.99) << " ms"
+			  << "  max " << std::setw(7) << latencies.back() << " ms"
+			  << "  avg threads " << std::setw(5) << averageSize
+			  << "  peak " << stats.peakWorkers
+			  << "  grown/retired " << stats.grown << "/" << stats.retired << std::endl;
+	std::cout << "  threads over time (50 ms): " << timeline << std::endl;
+}
+
+int main() {
+	WorkerPool::Config fixed;
+	WorkerPool::Config elastic;
+	elastic.minWorkers = 2;
+	elastic.maxWorkers = 32;
+	elastic.growThreshold = std::chrono::milliseconds(2);
+	elastic.idleTimeout = std::chrono::milliseconds(300);
+	elastic.resizeCooldown = std::chrono::milliseconds(250);
+
+	std::cout << BURSTS << " bursts of " << JOBS_PER_BURST << " x 1 ms blocking jobs every "
+			  << BURST_PERIOD.count() << " ms" << std::endl;
+	run("fixed 2 (average)", 2, fixed);
+	run("fixed 32 (peak)", 32, fixed);
+	run("elastic 2..32", 2, elastic);
+	return 0;
+}
@@ -0,0 +1,61 @@
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static long serialFib(int n) {
+	return n < 2 ? n : serialFib(n - 1) + serialFib(n - 2);
+}
+
+// Recursive fork: every node above the cutoff spawns both children as jobs
+static void parallelFib(WorkerPool &pool, int n, int cutoff, std::atomic<long> &sum, std::atomic<long> &outstanding) {
+	if (n <= cutoff) {
+		sum.fetch_add(serialFib(n), std::memory_order_relaxed);
+		outstanding.fetch_sub(1);
+		return;
+	}
+	outstanding.fetch_add(2);
+	pool.addJob([&pool, n, cutoff, &sum, &outstanding]() { parallelFib(pool, n - 1, cutoff, sum, outstanding); });
+	pool.addJob([&pool, n, cutoff, &sum, &outstanding]() { parallelFib(pool, n - 2, cutoff, sum, outstanding); });
+	outstanding.fetch_sub(1);
+}
+
+static double run(size_t workers, int n, int cutoff, long &result) {
+	WorkerPool pool(workers);
+	std::atomic<long> sum{0};
+	std::atomic<long> outstanding{1};
+
+	auto start = Clock::now();
+	pool.addJob([&pool, n, cutoff, &sum, &outstanding]() { parallelFib(pool, n, cutoff, sum, outstanding); });
+	while (outstanding.load() != 0)
+		std::this_thread::yield();
+	result = sum.load();
+	return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+int main() {
+	const int n = 36;
+	const int cutoff = 18;
+	unsigned int maxWorkers = std::max(1u, std::thread::hardware_concurrency());
+
+	auto serialStart = Clock::now();
+	long expected = serialFib(n);
+	double serialMs = std::chrono::duration<double, std::milli>(Clock::now() - serialStart).count();
+	std::cout << "fib(" << n << ") serial: " << std::fixed << std::setprecision(1) << serialMs << " ms" << std::endl;
+
+	double baseMs = 0;
+	for (unsigned int workers = 1; workers <= maxWorkers; workers *= 2) {
+		long result = 0;
+		double ms = run(workers, n, cutoff, result);
+		if (workers == 1)
+			baseMs = ms;
+		std::cout << std::setw(3) << workers << " workers: " << std::setw(8) << ms << " ms, speedup x"
+				  << std::setprecision(2) << baseMs / ms << (result == expected ? "" : "  (WRONG RESULT)")
+				  << std::setprecision(1) << std::endl;
+	}
+	return 0;
+}
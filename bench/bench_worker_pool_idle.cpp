@@ -0,0 +1,76 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <sys/resource.h>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static double processCpuSeconds() {
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+static double idleCpuUsage(WorkerPool::IdlePolicy policy, size_t workers) {
+	WorkerPool::Config config;
+	config.idlePolicy = policy;
+	WorkerPool pool(workers, config);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	double cpuStart = processCpuSeconds();
+	auto wallStart = Clock::now();
+	std::this_thread::sleep_for(std::chrono::seconds(1));
+	double cpu = processCpuSeconds() - cpuStart;
+	double wall = std::chrono::duration<double>(Clock::now() - wallStart).count();
+
+	return cpu / wall;
+}
+
+static std::vector<double> wakeupLatencies(WorkerPool::IdlePolicy policy, size_t workers, int samples, std::chrono::microseconds gap) {
+	WorkerPool::Config config;
+	config.idlePolicy = policy;
+	WorkerPool pool(workers, config);
+	std::vector<double> latencies;
+	latencies.reserve(samples);
+
+	for (int i = 0; i < samples; ++i) {
+		std::this_thread::sleep_for(gap);
+		std::atomic<bool> done{false};
+		Clock::time_point started;
+		auto submitted = Clock::now();
+		pool.addJob([&started, &done]() {
+			started = Clock::now();
+			done.store(true, std::memory_order_release);
+		});
+		while (!done.load(std::memory_order_acquire))
+			std::this_thread::yield();
+		latencies.push_back(std::chrono::duration<double, std::micro>(started - submitted).count());
+	}
+	std::sort(latencies.begin(), latencies.end());
+	return latencies;
+}
+
+static void report(const char *name, WorkerPool::IdlePolicy policy) {
+	const size_t workers = 8;
+
+	double cores = idleCpuUsage(policy, workers);
+	std::cout << name << ": idle CPU with " << workers << " workers = " << std::fixed << std::setprecision(3) << cores << " cores" << std::endl;
+
+	for (auto gap : {std::chrono::microseconds(50), std::chrono::microseconds(5000)}) {
+		auto latencies = wakeupLatencies(policy, workers, 500, gap);
+		std::cout << "  submit-to-start after " << std::setw(5) << gap.count() << "us idle: "
+				  << "p50 " << std::setprecision(1) << latencies[latencies.size() / 2] << "us, "
+				  << "p99 " << latencies[latencies.size() * 99 / 100] << "us" << std::endl;
+	}
+}
+
+int main() {
+	report("LATENCY", WorkerPool::IdlePolicy::LATENCY);
+	report("CPU", WorkerPool::IdlePolicy::CPU);
+	return 0;
+}
@@ -0,0 +1,77 @@
+#include <iostream>
+#include <iomanip>
+#include <atomic>
+#include <chrono>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** Cost of WorkerPool job instrumentation: the isolated recording path a
+** worker runs per job, then end-to-end throughput of tiny jobs with
+** recordStats off and on. Build the library with -DLIBFTPP_POOL_STATS=0 to
+** compare against the compiled-out variant.
+*/
+static double recordingCost(size_t iterations) {
+	LatencyHistogram wait;
+	LatencyHistogram execution;
+	std::atomic<uint64_t> busy{0};
+	uint64_t enqueuedAt = CycleClock::now();
+
+	auto start = Clock::now();
+	for (size_t i = 0; i < iterations; ++i) {
+		uint64_t started = CycleClock::now();
+		uint64_t finished = CycleClock::now();
+		wait.record(started - enqueuedAt);
+		execution.record(finished - started);
+		busy.store(busy.load(std::memory_order_relaxed) + (finished - started), std::memory_order_relaxed);
+		enqueuedAt = finished;
+	}
+	double nanoseconds = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+	return nanoseconds / iterations;
+}
+
+static double clockReadCost(size_t iterations) {
+	uint64_t sum = 0;
+
+	auto start = Clock::now();
+	for (size_t i = 0; i < iterations; ++i)
+		sum += CycleClock::now();
+	double nanoseconds = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+	return (nanoseconds + (sum & 1)) / iterations;
+}
+
+static void throughput(const char *name, bool record, size_t jobs) {
+	WorkerPool::Config config;
+	config.recordStats = record;
+	WorkerPool pool(std::max(2u, std::thread::hardware_concurrency()), config);
+	std::atomic<long> counter{0};
+
+	auto start = Clock::now();
+	for (size_t i = 0; i < jobs; ++i)
+		pool.addJob([&counter]() { counter.fetch_add(1, std::memory_order_relaxed); });
+	pool.waitAll();
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+	WorkerPool::Stats stats = pool.stats();
+	std::cout << std::left << std::setw(14) << name << std::right << std::fixed << std::setprecision(1)
+			  << std::setw(8) << jobs / seconds / 1e6 << " M jobs/s";
+	if (record) {
+		std::cout << "  wait p50/p99 " << stats.wait.percentile(0.5) << "/" << stats.wait.percentile(0.99) << " ns"
+				  << "  exec p50/p99 " << stats.execution.percentile(0.5) << "/" << stats.execution.percentile(0.99) << " ns";
+	}
+	std::cout << std::endl;
+}
+
+int main() {
+	std::cout << "LIBFTPP_POOL_STATS=" << LIBFTPP_POOL_STATS << std::endl;
+	double clock = clockReadCost(20000000);
+	double recording = recordingCost(20000000);
+	std::cout << std::fixed << std::setprecision(1)
+			  << "CycleClock::now(): " << clock << " ns" << std::endl
+			  << "Recording path:    " << recording << " ns per job (2 clock reads + "
+			  << recording - 2 * clock << " ns histogram updates)" << std::endl;
+	throughput("stats off", false, 2000000);
+	throughput("stats on", true, 2000000);
+	return 0;
+}
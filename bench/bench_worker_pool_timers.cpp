@@ -0,0 +1,99 @@
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <random>
+#include "../libftpp.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+/*
+** 100k pending timers on one WorkerPool timer thread, half of them
+** cancelled before firing, against one-thread-per-timer Timer::startAfter
+** for a smaller count. Reports scheduling cost, firing lateness and the
+** process thread count while the timers are pending.
+*/
+static size_t processThreads() {
+	std::ifstream status("/proc/self/status");
+	std::string line;
+
+	while (std::getline(status, line)) {
+		if (line.rfind("Threads:", 0) == 0)
+			return std::stoul(line.substr(8));
+	}
+	return 0;
+}
+
+static void poolTimers(size_t count) {
+	WorkerPool pool(4);
+	std::vector<double> lateness;
+	std::mutex latenessMutex;
+	std::atomic<size_t> fired{0};
+	std::vector<TimerHandle> handles;
+	std::mt19937 random(42);
+	std::uniform_int_distribution<int> delay(100, 1500);
+	lateness.reserve(count);
+	handles.reserve(count);
+
+	auto start = Clock::now();
+	for (size_t i = 0; i < count; ++i) {
+		auto wait = std::chrono::milliseconds(delay(random));
+		auto due = Clock::now() + wait;
+		handles.push_back(pool.schedule(wait, [&, due]() {
+			double late = std::chrono::duration<double, std::micro>(Clock::now() - due).count();
+			std::lock_guard<std::mutex> lock(latenessMutex);
+			lateness.push_back(late);
+			fired.fetch_add(1);
+		}));
+	}
+	double scheduleSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+	size_t threads = processThreads();
+
+	size_t cancelled = 0;
+	for (size_t i = 0; i < count; i += 2)
+		cancelled += handles[i].cancel();
+
+	while (fired.load() + cancelled < count && Clock::now() - start < std::chrono::seconds(10))
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	pool.waitAll();
+
+	std::lock_guard<std::mutex> lock(latenessMutex);
+	std::sort(lateness.begin(), lateness.end());
+	std::cout << std::fixed << std::setprecision(1)
+			  << "WorkerPool::schedule x" << count << ": " << scheduleSeconds * 1e9 / count << " ns/schedule, "
+			  << threads << " threads while pending" << std::endl
+			  << "  fired " << fired.load() << ", cancelled " << cancelled
+			  << ", lateness p50 " << lateness[lateness.size() / 2] << " us"
+			  << ", p99 " << lateness[lateness.size() * 99 / 100] << " us"
+			  << ", max " << lateness.back() << " us" << std::endl;
+}
+
+static void asyncTimers(size_t count) {
+	Timer timer;
+	std::vector<std::future<void>> futures;
+	std::atomic<size_t> fired{0};
+	futures.reserve(count);
+
+	auto start = Clock::now();
+	for (size_t i = 0; i < count; ++i)
+		futures.push_back(timer.startAfter(Timer::duration_ms(500), [&fired]() { fired.fetch_add(1); }));
+	double scheduleSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+	size_t threads = processThreads();
+	for (auto &future : futures)
+		future.wait();
+
+	std::cout << std::fixed << std::setprecision(1)
+			  << "Timer::startAfter x" << count << ": " << scheduleSeconds * 1e9 / count << " ns/schedule, "
+			  << threads << " threads while pending, fired " << fired.load() << std::endl;
+}
+
+int main() {
+	poolTimers(100000);
+	asyncTimers(1000);
+	return 0;
+}
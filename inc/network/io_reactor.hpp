@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   io_reactor.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:38:19 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 01:24:39 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef IO_REACTOR_HPP
+# define IO_REACTOR_HPP
+
+#include <atomic>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+
+#include "../threading/worker_pool.hpp"
+
+/*
+** One thread waiting on socket readiness (epoll) for any number of file
+** descriptors, handing one-shot callbacks to a WorkerPool when a socket
+** becomes readable or writable. Errors and hang-ups count as ready so the
+** callback's own recv/send reports them. Each descriptor can have one
+** pending read and one pending write waiter at a time.
+**
+** With C++20, `co_await reactor.readable(fd)` suspends a Task until the
+** socket is ready and resumes it on the pool. Destroying the reactor drops
+** pending callbacks but resumes waiting coroutines, whose co_await then
+** throws std::system_error(ECANCELED).
+*/
+class IoReactor
+{
+	public:
+		enum class Interest
+		{
+			READ,
+			WRITE
+		};
+
+		explicit IoReactor(WorkerPool &);
+		IoReactor(const IoReactor &) = delete;
+		IoReactor &operator=(const IoReactor &) = delete;
+		~IoReactor() noexcept;
+
+		void watch(int, Interest, Job &&);
+		void cancel(int);
+		size_t watched() const;
+
+#if LIBFTPP_COROUTINES
+		class ReadyAwaitable
+		{
+			public:
+				ReadyAwaitable(IoReactor &, int, Interest) noexcept;
+				bool await_ready() const noexcept;
+				void await_suspend(std::coroutine_handle<>);
+				void await_resume() const;
+
+			private:
+				IoReactor &_reactor;
+				int _fd;
+				Interest _interest;
+				int _error;
+		};
+
+		ReadyAwaitable readable(int) noexcept;
+		ReadyAwaitable writable(int) noexcept;
+#endif
+
+	private:
+		struct Waiter
+		{
+			Job job;
+			int *error = nullptr;								// coroutine waiters only; ECANCELED on destruction
+		};
+
+		struct Waiters
+		{
+			Waiter read;
+			Waiter write;
+		};
+
+		WorkerPool &_pool;
+		int _epoll;
+		int _wakeFd;
+		std::atomic<bool> _running;
+		mutable std::mutex _mutex;
+		std::unordered_map<int, Waiters> _waiters;
+		std::thread _thread;
+
+		void addWaiter(int, Interest, Job &&, int *);
+		void run();
+		void arm(int, const Waiters &);
+};
+
+#if LIBFTPP_COROUTINES
+
+inline IoReactor::ReadyAwaitable::ReadyAwaitable(IoReactor &reactor, int fd, Interest interest) noexcept : _reactor(reactor), _fd(fd), _interest(interest), _error(0)
+{
+}
+
+inline bool IoReactor::ReadyAwaitable::await_ready() const noexcept
+{
+	return false;
+}
+
+inline void IoReactor::ReadyAwaitable::await_suspend(std::coroutine_handle<> handle)
+{
+	_reactor.addWaiter(_fd, _interest, Job([handle]() { handle.resume(); }), &_error);
+}
+
+inline void IoReactor::ReadyAwaitable::await_resume() const
+{
+	if (_error)
+		throw std::system_error(_error, std::generic_category(), "IoReactor destroyed while waiting");
+}
+
+inline IoReactor::ReadyAwaitable IoReactor::readable(int fd) noexcept
+{
+	return ReadyAwaitable(*this, fd, Interest::READ);
+}
+
+inline IoReactor::ReadyAwaitable IoReactor::writable(int fd) noexcept
+{
+	return ReadyAwaitable(*this, fd, Interest::WRITE);
+}
+
+#endif
+
+#endif
@@ -0,0 +1,89 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   async_line_writer.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:01:12 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:01:12 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ASYNC_LINE_WRITER_HPP
+# define ASYNC_LINE_WRITER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+/*
+** Hands finished lines to a background thread that writes them to a file
+** descriptor with batched writev(2) calls.
+**
+** Producers push onto an intrusive multi-producer/single-consumer queue
+** (one exchange and one store per line, no lock), so each line stays
+** whole and lines from one thread keep their order. The writer drains up
+** to BatchLines lines per system call and sleeps when the queue is empty.
+** flush() blocks until every line submitted before it has been written.
+*/
+class AsyncLineWriter
+{
+	public:
+		static constexpr size_t BatchLines = 512;
+
+		explicit AsyncLineWriter(int fd);
+		AsyncLineWriter(const AsyncLineWriter &) = delete;
+		AsyncLineWriter& operator=(const AsyncLineWriter &) = delete;
+		~AsyncLineWriter() noexcept;
+
+		void start();
+		void stop();
+		bool isRunning() const noexcept;
+
+		void submit(const char *, size_t);
+		void flush();
+
+		uint64_t linesWritten() const noexcept;
+		uint64_t writeCalls() const noexcept;
+
+	private:
+		struct FlushRequest;
+
+		struct Node
+		{
+			std::atomic<Node *> next;
+			size_t size;
+			FlushRequest *flush;
+
+			char *text() noexcept;
+		};
+
+		int _fd;
+		Node *_head;
+		alignas(64) std::atomic<Node *> _tail;
+		alignas(64) std::atomic<bool> _sleeping;
+		std::atomic<bool> _stopping;
+		std::atomic<uint64_t> _linesWritten;
+		std::atomic<uint64_t> _writeCalls;
+
+		std::mutex _wakeMutex;
+		std::condition_variable _wakeCondition;
+		std::mutex _flushMutex;
+		std::condition_variable _flushCondition;
+		mutable std::mutex _stateMutex;
+		std::thread _thread;
+
+		static Node *allocate(size_t);
+		static void release(Node *) noexcept;
+
+		void push(Node *) noexcept;
+		bool drain(bool);
+		void writeAll(struct iovec *, size_t);
+		void writerRoutine();
+};
+
+#endif
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bounded_mpmc_queue.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:15:23 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:15:23 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BOUNDED_MPMC_QUEUE_HPP
+# define BOUNDED_MPMC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+/*
+** Vyukov bounded multi-producer/multi-consumer ring. Every slot is
+** constructed once up front and reused: pushWith() and popWith() hand the
+** caller the slot itself, so values with heap storage (strings, vectors)
+** keep their capacity from one lap to the next and a warmed-up queue
+** never allocates. Each slot carries a sequence number; a push or pop
+** claims a position with one CAS and publishes the slot with one store.
+*/
+template <typename TType>
+class BoundedMPMCQueue
+{
+	public:
+		explicit BoundedMPMCQueue(size_t);
+		BoundedMPMCQueue(const BoundedMPMCQueue &) = delete;
+		BoundedMPMCQueue &operator=(const BoundedMPMCQueue &) = delete;
+		~BoundedMPMCQueue() noexcept = default;
+
+		template <typename TFill> bool tryPushWith(TFill &&);
+		template <typename TConsume> bool tryPopWith(TConsume &&);
+		bool tryPush(const TType &);
+		bool tryPop(TType &);
+
+		size_t capacity() const noexcept;
+		size_t sizeApprox() const noexcept;
+		uint64_t pushed() const noexcept;
+		uint64_t popped() const noexcept;
+
+	private:
+		struct alignas(64) Slot
+		{
+			std::atomic<uint64_t> sequence;
+			TType value;
+		};
+
+		const uint64_t _mask;
+		std::unique_ptr<Slot[]> _slots;
+		alignas(64) std::atomic<uint64_t> _enqueuePos;
+		alignas(64) std::atomic<uint64_t> _dequeuePos;
+
+		static uint64_t roundUp(size_t);
+};
+
+#include "../../srcs/threading/bounded_mpmc_queue.tpp"
+
+#endif
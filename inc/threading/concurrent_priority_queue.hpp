@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_priority_queue.hpp                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:56:05 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 21:56:05 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_PRIORITY_QUEUE_HPP
+# define CONCURRENT_PRIORITY_QUEUE_HPP
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <algorithm>
+#include <type_traits>
+#include <memory>
+#include <cstdint>
+#include <thread>
+#include <stdexcept>
+
+/*
+** Relaxed multi-queue: items are spread over several independently locked
+** binary heaps. pop() samples two shards and takes the better top, so the
+** returned item is one of the highest priorities, not strictly the highest.
+** Higher priority values are popped first; equal priorities are FIFO within
+** a shard.
+*/
+template <typename TType, typename TPriority = int>
+class ConcurrentPriorityQueue
+{
+	static_assert(std::is_arithmetic<TPriority>::value, "ConcurrentPriorityQueue priority must be an arithmetic type");
+
+	public:
+		ConcurrentPriorityQueue();
+		explicit ConcurrentPriorityQueue(size_t);
+		ConcurrentPriorityQueue(const ConcurrentPriorityQueue &) = delete;
+		ConcurrentPriorityQueue(ConcurrentPriorityQueue &&) = delete;
+		ConcurrentPriorityQueue &operator=(const ConcurrentPriorityQueue &) = delete;
+		ConcurrentPriorityQueue &operator=(ConcurrentPriorityQueue &&) = delete;
+		~ConcurrentPriorityQueue() noexcept = default;
+
+		void push(TPriority, const TType &);
+		void push(TPriority, TType &&);
+		bool pop(TType &);
+		bool tryPop(TType &);
+
+		void close() noexcept;
+		bool isClosed() const noexcept;
+		void clear() noexcept;
+		bool empty() const noexcept;
+		size_t size() const noexcept;
+		size_t shardCount() const noexcept;
+
+	private:
+		struct Entry
+		{
+			TPriority priority;
+			uint64_t sequence;
+			TType value;
+		};
+
+		struct EntryCompare
+		{
+			bool operator()(const Entry &, const Entry &) const noexcept;
+		};
+
+		struct alignas(64) Shard
+		{
+			std::mutex mutex;
+			std::vector<Entry> heap;
+			uint64_t sequence = 0;
+			std::atomic<bool> hasItems{false};
+			std::atomic<TPriority> top{TPriority()};
+		};
+
+		std::unique_ptr<Shard[]> _shards;
+		size_t _shardCount;
+
+		std::atomic<size_t> _size;
+		std::atomic<size_t> _waiters;
+		std::atomic<bool> _closed;
+		std::mutex _waitMutex;
+		std::condition_variable _cv;
+
+		template <typename TValue> void pushImpl(TPriority, TValue &&);
+		bool popFromShard(Shard &, TType &);
+		void publishTop(Shard &) noexcept;
+		void notifyOne();
+		size_t randomIndex() const noexcept;
+};
+
+#include "../../srcs/threading/concurrent_priority_queue.tpp"
+
+#endif
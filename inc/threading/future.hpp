@@ -0,0 +1,169 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   future.hpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:03:45 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 00:36:04 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FUTURE_HPP
+# define FUTURE_HPP
+
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <optional>
+#include <functional>
+#include <exception>
+#include <stdexcept>
+#include <future>
+#include <type_traits>
+#include <chrono>
+
+class WorkerPool;
+
+template <typename TType> class Future;
+template <typename TType> class Promise;
+
+namespace FutureDetail {
+
+	struct VoidValue {};
+
+	template <typename TType>
+	using Stored = typename std::conditional<std::is_void<TType>::value, VoidValue, TType>::type;
+
+	template <typename TType>
+	class State
+	{
+		public:
+			State() noexcept;
+			State(const State &) = delete;
+			State &operator=(const State &) = delete;
+
+			void setValue(Stored<TType> &&);
+			void setException(std::exception_ptr);
+			void abandon() noexcept;
+			void onReady(std::function<void()>);
+
+			bool isReady() const noexcept;
+			void wait() const;
+			bool waitFor(std::chrono::nanoseconds) const;
+			Stored<TType> take();
+
+		private:
+			mutable std::mutex _mutex;
+			mutable std::condition_variable _condition;
+			std::atomic<bool> _ready;
+			std::optional<Stored<TType>> _value;
+			std::exception_ptr _exception;
+			std::vector<std::function<void()>> _continuations;
+
+			void markReady(std::unique_lock<std::mutex> &);
+	};
+
+	template <typename TType, typename TFunction>
+	void fulfill(State<TType> &, TFunction &&);
+
+	struct Access
+	{
+		template <typename TType> static std::shared_ptr<State<TType>> &state(Future<TType> &) noexcept;
+		template <typename TType> static std::shared_ptr<State<TType>> &state(Promise<TType> &) noexcept;
+		template <typename TType> static WorkerPool *pool(const Future<TType> &) noexcept;
+	};
+
+	template <typename TType, typename TFunction>
+	struct ContinuationResult
+	{
+		using type = typename std::invoke_result<TFunction, TType>::type;
+	};
+
+	template <typename TFunction>
+	struct ContinuationResult<void, TFunction>
+	{
+		using type = typename std::invoke_result<TFunction>::type;
+	};
+}
+
+/*
+** Move-only handle to a result produced on a WorkerPool. get() rethrows the
+** job's exception. Waiting from inside a pool worker runs other queued jobs
+** instead of blocking the thread.
+*/
+template <typename TType>
+class Future
+{
+	public:
+		Future() noexcept;
+		Future(std::shared_ptr<FutureDetail::State<TType>>, WorkerPool *) noexcept;
+		Future(const Future &) = delete;
+		Future(Future &&) noexcept;
+		Future &operator=(const Future &) = delete;
+		Future &operator=(Future &&) noexcept;
+		~Future() noexcept = default;
+
+		bool valid() const noexcept;
+		bool isReady() const;
+		void wait() const;
+		TType get();
+
+		template <typename TFunction>
+		Future<typename FutureDetail::ContinuationResult<TType, TFunction>::type> then(TFunction &&);
+
+	private:
+		friend struct FutureDetail::Access;
+
+		std::shared_ptr<FutureDetail::State<TType>> _state;
+		WorkerPool *_pool;
+
+		void checkValid() const;
+};
+
+/*
+** Destroying a Promise that was never satisfied breaks it: its Future
+** throws std::future_error(broken_promise) instead of waiting forever.
+*/
+template <typename TType>
+class Promise
+{
+	public:
+		Promise();
+		Promise(const Promise &) = delete;
+		Promise(Promise &&) noexcept = default;
+		Promise &operator=(const Promise &) = delete;
+		Promise &operator=(Promise &&) noexcept;
+		~Promise() noexcept;
+
+		Future<TType> getFuture(WorkerPool * = nullptr);
+		template <typename TValue> void setValue(TValue &&);
+		void setValue();
+		void setException(std::exception_ptr);
+
+	private:
+		friend struct FutureDetail::Access;
+
+		std::shared_ptr<FutureDetail::State<TType>> _state;
+};
+
+template <typename TType>
+struct WhenAnyResult
+{
+	size_t index;
+	std::vector<Future<TType>> futures;
+};
+
+template <typename TType>
+Future<std::vector<TType>> whenAll(std::vector<Future<TType>>);
+inline Future<void> whenAll(std::vector<Future<void>>);
+
+template <typename TType>
+Future<WhenAnyResult<TType>> whenAny(std::vector<Future<TType>>);
+
+#include "worker_pool.hpp"
+
+#endif
@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job.hpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:10:04 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:10:04 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef JOB_HPP
+# define JOB_HPP
+
+#include <cstddef>
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <functional>
+
+/*
+** Move-only `void()` callable. Callables up to InlineSize bytes that are
+** nothrow-movable live in the object itself, so wrapping a typical lambda
+** never touches the heap; larger ones fall back to a single allocation.
+*/
+class Job
+{
+	public:
+		static constexpr size_t InlineSize = 64;
+
+		Job() noexcept;
+		Job(std::nullptr_t) noexcept;
+		template <typename TFunction, typename = typename std::enable_if<
+			!std::is_same<typename std::decay<TFunction>::type, Job>::value
+			&& std::is_invocable<typename std::decay<TFunction>::type &>::value>::type>
+		Job(TFunction &&);
+		Job(const Job &) = delete;
+		Job(Job &&) noexcept;
+		Job &operator=(const Job &) = delete;
+		Job &operator=(Job &&) noexcept;
+		~Job() noexcept;
+
+		void operator()();
+		explicit operator bool() const noexcept;
+		bool isInline() const noexcept;
+		void reset() noexcept;
+
+	private:
+		struct Operations
+		{
+			void (*invoke)(void *);
+			void (*move)(void *, void *) noexcept;
+			void (*destroy)(void *) noexcept;
+			bool isInline;
+		};
+
+		template <typename TFunction> struct InlineStorage
+		{
+			static void invoke(void *);
+			static void move(void *, void *) noexcept;
+			static void destroy(void *) noexcept;
+			static const Operations operations;
+		};
+
+		template <typename TFunction> struct HeapStorage
+		{
+			static void invoke(void *);
+			static void move(void *, void *) noexcept;
+			static void destroy(void *) noexcept;
+			static const Operations operations;
+		};
+
+		template <typename TFunction> static constexpr bool fitsInline();
+
+		alignas(std::max_align_t) unsigned char _storage[InlineSize];
+		const Operations *_operations;
+};
+
+#include "../../srcs/threading/job.tpp"
+
+#endif
@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_algorithms.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:06:03 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 01:18:54 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLEL_ALGORITHMS_HPP
+# define PARALLEL_ALGORITHMS_HPP
+
+#include <vector>
+#include <optional>
+#include <iterator>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+#include <type_traits>
+
+#include "worker_pool.hpp"
+
+/*
+** Range algorithms split [begin, end) into chunks of `grain` elements and run
+** them on the pool; a grain of 0 picks about eight chunks per worker. Every
+** call returns once all of its chunks are done and rethrows the first
+** exception raised by a chunk. Called from a worker, the wait helps the pool.
+** parallelFor passes the index when the range is integral, the element
+** otherwise.
+*/
+
+template <typename TIterator, typename TFunction>
+void parallelFor(WorkerPool &, TIterator, TIterator, size_t, TFunction);
+template <typename TIterator, typename TFunction>
+void parallelFor(WorkerPool &, TIterator, TIterator, TFunction);
+
+template <typename TIterator, typename TValue, typename TBinaryOp>
+TValue parallelReduce(WorkerPool &, TIterator, TIterator, TValue, TBinaryOp, size_t = 0);
+template <typename TIterator, typename TValue>
+TValue parallelReduce(WorkerPool &, TIterator, TIterator, TValue);
+
+template <typename TInputIt, typename TOutputIt, typename TUnaryOp>
+TOutputIt parallelTransform(WorkerPool &, TInputIt, TInputIt, TOutputIt, TUnaryOp, size_t = 0);
+
+template <typename TInputIt, typename TOutputIt, typename TBinaryOp>
+TOutputIt parallelScan(WorkerPool &, TInputIt, TInputIt, TOutputIt, TBinaryOp, size_t = 0);
+template <typename TInputIt, typename TOutputIt>
+TOutputIt parallelScan(WorkerPool &, TInputIt, TInputIt, TOutputIt);
+
+template <typename TIterator, typename TCompare>
+void parallelSort(WorkerPool &, TIterator, TIterator, TCompare, size_t = 0);
+template <typename TIterator>
+void parallelSort(WorkerPool &, TIterator, TIterator);
+
+#include "../../srcs/threading/parallel_algorithms.tpp"
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/11 14:50:47 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 16:41:27 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 22:50:51 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -17,14 +17,46 @@
 #include <functional>
 #include <thread>
 #include <mutex>
-#include <unordered_map>
+#include <memory>
+#include <vector>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
 
-
+/*
+** Runs named tasks repeatedly, each at its own period, on one thread.
+**
+** The task set is an immutable snapshot (a contiguous vector) published
+** through an atomic shared_ptr. addTask/removeTask copy it, edit the copy
+** and swap it in; the worker loads the current snapshot without locking or
+** copying, and a snapshot being iterated stays alive until the worker
+** drops it.
+**
+** The worker keeps a min-heap of next deadlines and sleeps exactly until
+** the earliest one, waking early when the task set changes. New tasks run
+** immediately, then every period. A task that falls behind skips the
+** missed ticks (counted as overruns) instead of running back to back.
+*/
 class PersistentWorker
 {
 	public:
+		using Clock = std::chrono::steady_clock;
+		using duration = Clock::duration;
+
+		struct TaskStats
+		{
+			duration period;
+			uint64_t runs;
+			uint64_t overruns;
+			duration meanJitter;
+			duration maxJitter;
+			duration meanDuration;
+			duration maxDuration;
+		};
+
+		static constexpr std::chrono::milliseconds DefaultPeriod{100};
+
 		PersistentWorker();
 		PersistentWorker(const PersistentWorker &) = delete;
 		PersistentWorker(PersistentWorker &&) noexcept;
@@ -33,15 +65,63 @@ class PersistentWorker
 		~PersistentWorker() noexcept;
 
 		void addTask(const std::string &, const std::function<void()> &);
+		void addTask(const std::string &, duration, const std::function<void()> &);
 		void removeTask(const std::string &);
 
+		bool hasTask(const std::string &) const;
+		size_t taskCount() const noexcept;
+		TaskStats getStats(const std::string &) const;
+
 	private:
+		/*
+		** Statistics are written by the worker only and read through
+		** relaxed atomics; the deadline fields belong to the worker thread.
+		*/
+		struct TaskState
+		{
+			std::function<void()> function;
+			duration period;
+			std::atomic<uint64_t> runs{0};
+			std::atomic<uint64_t> overruns{0};
+			std::atomic<int64_t> jitterSum{0};
+			std::atomic<int64_t> jitterMax{0};
+			std::atomic<int64_t> durationSum{0};
+			std::atomic<int64_t> durationMax{0};
+			Clock::time_point nextDeadline;
+			bool scheduled = false;
+		};
+
+		struct Task
+		{
+			std::string name;
+			std::shared_ptr<TaskState> state;
+		};
+
+		struct Deadline
+		{
+			Clock::time_point due;
+			TaskState *state;
+
+			bool operator>(const Deadline &) const noexcept;
+		};
+
+		using Snapshot = std::vector<Task>;
+		using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
 		std::mutex _mutex;
 		std::thread _workerThread;
 		std::atomic<bool> _running;
-		std::unordered_map<std::string, std::function<void()>> _um_tasks;
+		SnapshotPtr _tasks;
+
+		std::mutex _wakeMutex;
+		std::condition_variable _wakeCondition;
+		std::atomic<uint64_t> _generation;
 
+		SnapshotPtr loadTasks() const noexcept;
+		void storeTasks(SnapshotPtr) noexcept;
 		void workerRoutine();
+		void runTask(TaskState &, Clock::time_point);
+		static void rebuildDeadlines(const Snapshot &, std::vector<Deadline> &, Clock::time_point);
 };
 
 #endif
\ No newline at end of file
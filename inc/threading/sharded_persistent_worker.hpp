@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sharded_persistent_worker.hpp                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:51:45 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:51:45 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef SHARDED_PERSISTENT_WORKER_HPP
+# define SHARDED_PERSISTENT_WORKER_HPP
+
+#include "persistent_worker.hpp"
+
+#include <string>
+#include <functional>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <atomic>
+#include <unordered_map>
+
+/*
+** Spreads named periodic tasks over several PersistentWorker shards, one
+** thread each, so a slow task only delays the tasks sharing its shard.
+**
+** Tasks land on hash(name) % shards unless placed explicitly. rebalance()
+** redistributes the unpinned tasks by measured load (mean run duration
+** over period); a moved task restarts its cadence and statistics on its
+** new shard. Every task is wrapped in a busy flag, so a run still in
+** flight on the old shard is never overlapped by one on the new shard.
+*/
+class ShardedPersistentWorker
+{
+	public:
+		using duration = PersistentWorker::duration;
+		using TaskStats = PersistentWorker::TaskStats;
+
+		static constexpr double RebalanceTolerance = 0.1;
+
+		explicit ShardedPersistentWorker(size_t shardCount = std::thread::hardware_concurrency());
+		ShardedPersistentWorker(const ShardedPersistentWorker &) = delete;
+		ShardedPersistentWorker& operator=(const ShardedPersistentWorker &) = delete;
+		~ShardedPersistentWorker() noexcept = default;
+
+		void addTask(const std::string &, const std::function<void()> &);
+		void addTask(const std::string &, duration, const std::function<void()> &);
+		void addTask(const std::string &, duration, const std::function<void()> &, size_t shard);
+		void removeTask(const std::string &);
+
+		bool hasTask(const std::string &) const;
+		size_t taskCount() const;
+		size_t shardCount() const noexcept;
+		size_t shardOf(const std::string &) const;
+		TaskStats getStats(const std::string &) const;
+
+		size_t rebalance();
+
+	private:
+		struct Entry
+		{
+			duration period;
+			std::function<void()> function;
+			size_t shard;
+			bool pinned;
+			double load;
+		};
+
+		mutable std::mutex _mutex;
+		std::vector<std::unique_ptr<PersistentWorker>> _shards;
+		std::unordered_map<std::string, Entry> _tasks;
+
+		void place(const std::string &, duration, const std::function<void()> &, size_t, bool);
+		double measureLoad(const std::string &, Entry &) const;
+};
+
+#endif
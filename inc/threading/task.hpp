@@ -0,0 +1,150 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:37:37 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:37:37 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TASK_HPP
+# define TASK_HPP
+
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "worker_pool.hpp"
+
+#if LIBFTPP_COROUTINES
+
+template <typename TType = void> class Task;
+
+namespace TaskDetail {
+
+	/*
+	** A finished task resumes whoever awaited it by symmetric transfer, so
+	** long chains of awaited tasks do not grow the stack.
+	*/
+	struct FinalAwaiter
+	{
+		bool await_ready() const noexcept;
+		template <typename TPromise>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise>) noexcept;
+		void await_resume() const noexcept;
+	};
+
+	class PromiseBase
+	{
+		public:
+			std::suspend_always initial_suspend() const noexcept;
+			FinalAwaiter final_suspend() const noexcept;
+			void unhandled_exception() noexcept;
+
+			std::coroutine_handle<> continuation;
+
+		protected:
+			std::exception_ptr _exception;
+	};
+
+	template <typename TType>
+	class Promise : public PromiseBase
+	{
+		public:
+			Task<TType> get_return_object() noexcept;
+			template <typename TValue> void return_value(TValue &&);
+			TType result();
+
+		private:
+			std::optional<TType> _value;
+	};
+
+	template <>
+	class Promise<void> : public PromiseBase
+	{
+		public:
+			Task<void> get_return_object() noexcept;
+			void return_void() noexcept;
+			void result();
+	};
+
+	struct Detached
+	{
+		struct promise_type
+		{
+			Detached get_return_object() const noexcept;
+			std::suspend_never initial_suspend() const noexcept;
+			std::suspend_never final_suspend() const noexcept;
+			void return_void() const noexcept;
+			void unhandled_exception() const noexcept;
+		};
+	};
+
+	template <typename TType>
+	class FutureAwaiter
+	{
+		public:
+			explicit FutureAwaiter(Future<TType> &&) noexcept;
+			bool await_ready() const;
+			void await_suspend(std::coroutine_handle<>);
+			TType await_resume();
+
+		private:
+			Future<TType> _future;
+	};
+}
+
+/*
+** Lazily started coroutine producing a TType. A Task runs when it is
+** co_awaited by another coroutine, or when handed to spawn(), which starts
+** it on a WorkerPool and returns a Future for its result. Exceptions thrown
+** inside the task propagate to the awaiter (or into the Future).
+*/
+template <typename TType>
+class Task
+{
+	public:
+		using promise_type = TaskDetail::Promise<TType>;
+
+		Task() noexcept;
+		Task(const Task &) = delete;
+		Task(Task &&) noexcept;
+		Task &operator=(const Task &) = delete;
+		Task &operator=(Task &&) noexcept;
+		~Task() noexcept;
+
+		bool valid() const noexcept;
+
+		bool await_ready() const noexcept;
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<>) noexcept;
+		TType await_resume();
+
+	private:
+		friend class TaskDetail::Promise<TType>;
+
+		explicit Task(std::coroutine_handle<promise_type>) noexcept;
+
+		std::coroutine_handle<promise_type> _handle;
+};
+
+template <typename TType>
+Future<TType> spawn(WorkerPool &, Task<TType>);
+
+/*
+** `co_await future` suspends until the Future is ready and resumes on its
+** pool (or inline for a Future without one). The Future is consumed.
+*/
+template <typename TType>
+TaskDetail::FutureAwaiter<TType> operator co_await(Future<TType> &&) noexcept;
+template <typename TType>
+TaskDetail::FutureAwaiter<TType> operator co_await(Future<TType> &) noexcept;
+
+# include "../../srcs/threading/task.tpp"
+
+#endif
+
+#endif
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_graph.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:08:09 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 02:26:58 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TASK_GRAPH_HPP
+# define TASK_GRAPH_HPP
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <thread>
+#include <future>
+
+#include "worker_pool.hpp"
+
+/*
+** Fixed dependency graph executed on a WorkerPool. A node is scheduled as
+** soon as all of its predecessors have completed. The graph keeps its node
+** storage between runs, so the same graph can be replayed every frame
+** without reallocating. If a node throws, the remaining nodes are skipped
+** and wait() rethrows the first exception. A node job dropped by a pool
+** that shuts down fails the run with std::future_error(broken_promise).
+*/
+class TaskGraph
+{
+	public:
+		using NodeId = size_t;
+
+		TaskGraph();
+		TaskGraph(const TaskGraph &) = delete;
+		TaskGraph(TaskGraph &&) = delete;
+		TaskGraph &operator=(const TaskGraph &) = delete;
+		TaskGraph &operator=(TaskGraph &&) = delete;
+		~TaskGraph();
+
+		NodeId addNode(const std::string &, const std::function<void()> &);
+		void addDependency(NodeId, NodeId);
+		void clear();
+
+		void run(WorkerPool &);
+		void wait();
+		void runAndWait(WorkerPool &);
+
+		bool isRunning() const noexcept;
+		size_t size() const noexcept;
+		const std::string &getName(NodeId) const;
+
+	private:
+		struct Node
+		{
+			std::string name;
+			std::function<void()> task;
+			std::vector<NodeId> successors;
+			size_t predecessorCount;
+			std::atomic<size_t> remaining;
+		};
+
+		class NodeJob
+		{
+			public:
+				NodeJob(TaskGraph *, NodeId) noexcept;
+				NodeJob(const NodeJob &) = delete;
+				NodeJob(NodeJob &&) noexcept;
+				NodeJob &operator=(const NodeJob &) = delete;
+				NodeJob &operator=(NodeJob &&) = delete;
+				~NodeJob() noexcept;
+
+				void operator()();
+
+			private:
+				TaskGraph *_graph;
+				NodeId _node;
+		};
+
+		std::vector<std::unique_ptr<Node>> _nodes;
+		std::vector<NodeId> _roots;
+		bool _validated;
+
+		WorkerPool *_pool;
+		std::atomic<size_t> _remainingNodes;
+		std::atomic<bool> _failed;
+		std::exception_ptr _error;
+
+		mutable std::mutex _mutex;
+		std::condition_variable _condition;
+		bool _running;
+
+		void validate();
+		void checkNode(NodeId) const;
+		void checkIdle() const;
+		void schedule(NodeId) noexcept;
+		void execute(NodeId);
+		void abandon(NodeId) noexcept;
+		void finishRun();
+};
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/11 12:22:47 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 15:22:04 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 22:24:39 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,12 +20,14 @@
 #include <atomic>
 
 #include "thread_safe_iostream.hpp"
+#include "thread_attributes.hpp"
 
 class Thread 
 {
 	public:
 		Thread() = delete;
 		Thread(const std::string &, std::function<void()>);	
+		Thread(const std::string &, std::function<void()>, const ThreadAttributes &);
 		Thread(const Thread &) = delete;
 		Thread(Thread &&) noexcept;
 		Thread& operator=(const Thread &) = delete;
@@ -37,6 +39,7 @@ class Thread
 		
 		bool isRunning() const;
 		const std::string &getName() const;
+		const ThreadAttributes &getAttributes() const;
 		std::thread::id getThreadId() const;
 		
 	private:
@@ -44,6 +47,7 @@ class Thread
 		std::thread _thread;
 		std::atomic<bool> _running;
 		std::function<void()> _function;
+		ThreadAttributes _attributes;
 
 		static void entryPointThread(Thread *);
 };
@@ -0,0 +1,50 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_attributes.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:20:43 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:20:43 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef THREAD_ATTRIBUTES_HPP
+# define THREAD_ATTRIBUTES_HPP
+
+#include <string>
+#include <vector>
+
+/*
+** Placement and scheduling options applied by a thread to itself when it
+** starts. Empty / default fields leave the inherited setting untouched.
+** The OS name is truncated to 15 characters (the Linux limit).
+*/
+struct ThreadAttributes
+{
+	enum class SchedulingPolicy
+	{
+		INHERIT,
+		OTHER,
+		BATCH,
+		IDLE,
+		FIFO,
+		ROUND_ROBIN
+	};
+
+	std::string name;
+	std::vector<int> cpus;
+	SchedulingPolicy policy = SchedulingPolicy::INHERIT;
+	int priority = 0;
+	bool adjustNice = false;
+	int nice = 0;
+
+	void applyToCurrentThread() const;
+
+	static std::vector<int> availableCpus();
+	static std::vector<int> currentAffinity();
+	static std::string currentName();
+};
+
+#endif
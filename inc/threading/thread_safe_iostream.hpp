@@ -6,21 +6,74 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/10 23:44:52 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 14:09:29 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 00:32:51 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #ifndef THREAD_SAFE_IOSTREAM_HPP
 # define THREAD_SAFE_IOSTREAM_HPP
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <mutex>
+#include <thread>
 #include <string>
 #include <iostream>
 #include <sstream>
+#include <string_view>
+#include <charconv>
+#include <type_traits>
 
+class AsyncLineWriter;
+
+/*
+** In SYNC mode (the default) a finished line is written to std::cout under
+** a process-wide lock. In ASYNC mode it is handed to a background writer
+** thread instead, so slow terminals or pipes never block the caller; lines
+** stay whole and in per-thread order. flush() waits until every line
+** handed over so far has been written, and switching back to SYNC drains
+** the writer.
+**
+** In SYNC mode the flush policy decides when buffered lines reach the
+** descriptor: every line, every interval, every size bytes, or only on
+** flush() and at exit. The default is every line, so output interleaves
+** correctly with direct std::cout writes; stdoutFlushPolicy() suggests a
+** buffered policy for what stdout is, for callers that only print through
+** threadSafeCout. std::flush writes buffered lines in every mode, and so
+** does destroying a thread's stream, so output from joined threads always
+** precedes what comes after the join.
+**
+** A timestamped stream starts each line with the local time the line was
+** finished, to the millisecond, before the prefix.
+*/
 class ThreadSafeIOStream 
 {
 	public:
+		enum class OutputMode
+		{
+			SYNC,
+			ASYNC
+		};
+
+		enum class FlushMode
+		{
+			LINE,
+			INTERVAL,
+			SIZE,
+			EXIT
+		};
+
+		struct FlushPolicy
+		{
+			FlushMode mode = FlushMode::LINE;
+			std::chrono::milliseconds interval{50};
+			size_t size = 64 * 1024;
+		};
+
+		// EXIT mode still writes once this much output is pending
+		static constexpr size_t ExitFlushLimit = 8 * 1024 * 1024;
+
 		ThreadSafeIOStream();
 		ThreadSafeIOStream(const ThreadSafeIOStream &);
 		ThreadSafeIOStream& operator=(const ThreadSafeIOStream &);
@@ -30,6 +83,8 @@ class ThreadSafeIOStream
 
 		void setPrefix(const std::string &);
 		const std::string& getPrefix() const;
+		void setTimestamped(bool);
+		bool isTimestamped() const;
 
 		template<typename T> ThreadSafeIOStream &operator<<(const T &);
 		template<typename T> ThreadSafeIOStream& operator>>(T &);
@@ -38,14 +93,45 @@ class ThreadSafeIOStream
 
 		template<typename T> void prompt(const std::string &, T &);
 
+		static void setOutputMode(OutputMode);
+		static OutputMode getOutputMode() noexcept;
+		static void flush();
+
+		static void setFlushPolicy(const FlushPolicy &);
+		static FlushPolicy getFlushPolicy();
+		static FlushPolicy stdoutFlushPolicy();
+
 	private:
+		struct ExitFlush
+		{
+			~ExitFlush();
+		};
+
 		bool _line_start;
 		std::string _prefix;
+		bool _timestamped;
 		static std::mutex _global_mutex;
 		thread_local static std::string _buffer;
+		thread_local static std::string _output;
+		static std::atomic<bool> _async;
+		static FlushPolicy _flush_policy;
+		static std::string _pending;
+		static std::chrono::steady_clock::time_point _pending_since;
+		static std::thread _flusher;
+		static std::condition_variable _flusher_condition;
+		static bool _flusher_stop;
+		static ExitFlush _exit_flush;
 		
 		void print_prefix_if_needed();
-		std::string format_with_prefix(const std::string& text);
+		void format_with_prefix(std::string_view text, std::string &out) const;
+
+		template<typename T> static void append(std::string &, const T &);
+		static void append_manipulator(std::string &, std::ostream &(*)(std::ostream &));
+		static AsyncLineWriter &async_writer();
+		static bool flush_due(std::chrono::steady_clock::time_point);
+		static void write_pending();
+		static void stop_flusher(std::unique_lock<std::mutex> &);
+		static void flusher_routine();
 };
 
 extern thread_local ThreadSafeIOStream threadSafeCout;
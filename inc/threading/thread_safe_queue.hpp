@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/08 00:56:44 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 15:10:30 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 21:57:32 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -31,6 +31,8 @@ class ThreadSafeQueue
 		void push_front(const TType &) noexcept;
 		TType pop_back();
 		TType pop_front();
+		bool try_pop_back(TType &);
+		bool try_pop_front(TType &);
 
 		void clear() noexcept;
 		bool empty() const noexcept;
@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/08 00:57:42 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/11 15:36:36 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 23:26:22 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,9 +14,16 @@
 # define THREADING_HPP
 
 #include "thread_safe_iostream.hpp"
+#include "async_line_writer.hpp"
 #include "thread_safe_queue.hpp"
+#include "bounded_mpmc_queue.hpp"
+#include "concurrent_priority_queue.hpp"
 #include "thread.hpp"
 #include "worker_pool.hpp"
+#include "parallel_algorithms.hpp"
+#include "task_graph.hpp"
+#include "task.hpp"
 #include "persistent_worker.hpp"
+#include "sharded_persistent_worker.hpp"
 
 #endif
\ No newline at end of file
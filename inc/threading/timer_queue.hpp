@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timer_queue.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:31:22 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 02:18:29 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TIMER_QUEUE_HPP
+# define TIMER_QUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "job.hpp"
+
+class WorkerPool;
+
+/*
+** Cancellation handle for a job scheduled on a WorkerPool. A one-shot timer
+** can be cancelled until it is dispatched; a periodic timer stops firing
+** once cancelled (a run already in progress completes).
+*/
+class TimerHandle
+{
+	public:
+		TimerHandle() noexcept;
+
+		bool cancel() noexcept;
+		bool isActive() const noexcept;
+		explicit operator bool() const noexcept;
+
+	private:
+		friend class TimerQueue;
+		struct State;
+
+		explicit TimerHandle(std::shared_ptr<State>) noexcept;
+
+		std::shared_ptr<State> _state;
+};
+
+/*
+** Single thread holding a min-heap of deadlines for one WorkerPool. It
+** sleeps until the earliest deadline and hands due jobs to the pool, so
+** any number of pending timers costs one thread. Cancelled entries are
+** dropped lazily when they reach the top of the heap, and the heap is
+** rebuilt without them once they make up more than half of it; pending()
+** only counts live timers. Periodic timers run at a fixed rate; a tick
+** is skipped while the previous run is still going, and a timer that
+** fell more than one period behind is rescheduled from now instead of
+** firing a burst of catch-up runs.
+*/
+class TimerQueue
+{
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		TimerQueue(WorkerPool &, const std::string &);
+		TimerQueue(const TimerQueue &) = delete;
+		TimerQueue &operator=(const TimerQueue &) = delete;
+		~TimerQueue() noexcept;
+
+		TimerHandle add(Clock::time_point, Clock::duration, Job &&);
+		void stop() noexcept;
+		size_t pending() const;
+
+	private:
+		struct Entry
+		{
+			Clock::time_point due;
+			uint64_t sequence;
+			std::shared_ptr<TimerHandle::State> state;
+		};
+
+		struct Later
+		{
+			bool operator()(const Entry &, const Entry &) const noexcept;
+		};
+
+		WorkerPool &_pool;
+		mutable std::mutex _mutex;
+		std::condition_variable _condition;
+		std::vector<Entry> _heap;
+		std::shared_ptr<std::atomic<int64_t>> _cancelled;		// in the heap; raised by TimerHandle::cancel()
+		uint64_t _sequence;
+		bool _running;
+		std::thread _thread;
+
+		void run(const std::string &);
+		void dispatch(const std::shared_ptr<TimerHandle::State> &);
+		void compact();
+};
+
+#endif
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   work_stealing_deque.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:00:41 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:00:41 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WORK_STEALING_DEQUE_HPP
+# define WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <type_traits>
+
+/*
+** Chase-Lev deque. Only the owning thread may push() and take() (LIFO end);
+** any thread may steal() from the opposite end (FIFO). Retired buffers are
+** kept until destruction so concurrent stealers never read freed memory.
+*/
+template <typename TType>
+class WorkStealingDeque
+{
+	static_assert(std::is_trivially_copyable<TType>::value, "WorkStealingDeque elements must be trivially copyable");
+
+	public:
+		explicit WorkStealingDeque(size_t = 256);
+		WorkStealingDeque(const WorkStealingDeque &) = delete;
+		WorkStealingDeque(WorkStealingDeque &&) = delete;
+		WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+		WorkStealingDeque &operator=(WorkStealingDeque &&) = delete;
+		~WorkStealingDeque() noexcept = default;
+
+		void push(TType);
+		bool take(TType &) noexcept;
+		bool steal(TType &) noexcept;
+
+		bool empty() const noexcept;
+		size_t size() const noexcept;
+
+	private:
+		struct Buffer
+		{
+			explicit Buffer(int64_t);
+
+			int64_t capacity;
+			int64_t mask;
+			std::unique_ptr<std::atomic<TType>[]> slots;
+
+			void put(int64_t, TType) noexcept;
+			TType get(int64_t) const noexcept;
+		};
+
+		alignas(64) std::atomic<int64_t> _top;
+		alignas(64) std::atomic<int64_t> _bottom;
+		alignas(64) std::atomic<Buffer *> _buffer;
+		std::vector<std::unique_ptr<Buffer>> _buffers;
+
+		Buffer *grow(Buffer *, int64_t, int64_t);
+};
+
+#include "../../srcs/threading/work_stealing_deque.tpp"
+
+#endif
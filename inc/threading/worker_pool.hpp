@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/11 14:07:33 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 16:36:40 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 02:35:46 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,12 +16,48 @@
 #include <vector>
 #include <functional>
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <tuple>
+#include <type_traits>
+#include <cerrno>
+#include <system_error>
 
+/*
+** Coroutine support (Task, awaitables) is available when the library and
+** the including code are built as C++20: make CXXSTD=c++20.
+*/
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+# include <coroutine>
+# define LIBFTPP_COROUTINES 1
+#else
+# define LIBFTPP_COROUTINES 0
+#endif
+
+#include "future.hpp"
 #include "thread.hpp"
+#include "thread_attributes.hpp"
+#include "../time/cycle_clock.hpp"
+#include "../time/latency_histogram.hpp"
 #include "thread_safe_queue.hpp"
+#include "work_stealing_deque.hpp"
+#include "job.hpp"
+#include "timer_queue.hpp"
 #include "thread_safe_iostream.hpp"
 
+/*
+** Build with -DLIBFTPP_POOL_STATS=0 to compile per-job instrumentation out
+** entirely; Config::recordStats is then ignored.
+*/
+#ifndef LIBFTPP_POOL_STATS
+# define LIBFTPP_POOL_STATS 1
+#endif
+
+struct WorkerPoolNodeDepot;
+struct WorkerPoolNodeCache;
+
 class WorkerPool 
 {
 	public:
@@ -32,7 +68,77 @@ class WorkerPool
 				virtual void execute() = 0;
 		};
 			
+		/*
+		** Idle workers spin briefly, then yield, then park on a condition
+		** variable until a job is submitted. LATENCY spins and yields longer
+		** before parking; CPU parks almost immediately.
+		*/
+		enum class IdlePolicy
+		{
+			LATENCY,
+			CPU
+		};
+
+		/*
+		** With maxWorkers above the initial size the pool is elastic: a
+		** supervisor thread adds a worker whenever the oldest externally
+		** submitted job has waited longer than growThreshold, and workers
+		** parked for idleTimeout retire down to minWorkers. No worker
+		** retires within resizeCooldown of the last growth, so a pool that
+		** just grew rides out short gaps between bursts.
+		**
+		** workerAttributes is applied by every worker as it starts; its name
+		** becomes the prefix of the OS thread names ("<name>-<index>"). With
+		** pinWorkers each worker is bound to a single CPU, assigned round
+		** robin from workerAttributes.cpus (or every CPU available to the
+		** process when that list is empty).
+		**
+		** recordStats makes each worker time every job it runs: the wait
+		** from submission to start and the execution time go into
+		** per-worker histograms read through stats().
+		*/
+		struct Config
+		{
+			IdlePolicy idlePolicy = IdlePolicy::CPU;
+			size_t minWorkers = 0;
+			size_t maxWorkers = 0;
+			std::chrono::milliseconds growThreshold{10};
+			std::chrono::milliseconds idleTimeout{5000};
+			std::chrono::milliseconds resizeCooldown{500};
+			ThreadAttributes workerAttributes;
+			bool pinWorkers = false;
+			bool recordStats = false;
+		};
+
+		struct WorkerStats
+		{
+			bool active;
+			uint64_t jobsCompleted;
+			double busyRatio;
+			LatencyHistogram::Snapshot wait;
+			LatencyHistogram::Snapshot execution;
+		};
+
+		/*
+		** Latency figures are in nanoseconds. Job counts, busy ratios and
+		** histograms stay zero unless recordStats is enabled; busy ratio is
+		** measured since the worker slot first started.
+		*/
+		struct Stats
+		{
+			size_t workers;
+			size_t peakWorkers;
+			size_t grown;
+			size_t retired;
+			int64_t queueDepth;
+			uint64_t jobsCompleted;
+			LatencyHistogram::Snapshot wait;
+			LatencyHistogram::Snapshot execution;
+			std::vector<WorkerStats> perWorker;
+		};
+
 		WorkerPool(size_t);
+		WorkerPool(size_t, const Config &);
 		WorkerPool(const WorkerPool &) = delete;
 		WorkerPool(WorkerPool &&) noexcept = delete;
 		WorkerPool& operator=(const WorkerPool &) = delete;
@@ -41,13 +147,199 @@ class WorkerPool
 
 		void addJob(const std::function<void()> &);
 		void addJob(std::unique_ptr<IJobs>);
+		template <typename TFunction, typename = typename std::enable_if<
+			std::is_invocable<typename std::decay<TFunction>::type &>::value>::type>
+		void addJob(TFunction &&);
+
+		template <typename TFunction, typename ... TArgs>
+		Future<typename std::invoke_result<typename std::decay<TFunction>::type, typename std::decay<TArgs>::type ...>::type> submit(TFunction &&, TArgs && ...);
+
+		/*
+		** Run a job on the pool after a delay, or repeatedly every period.
+		** All timers of a pool share one timer thread, started on first use.
+		*/
+		template <typename TRep, typename TPeriod, typename TFunction>
+		TimerHandle schedule(const std::chrono::duration<TRep, TPeriod> &, TFunction &&);
+		template <typename TRep, typename TPeriod, typename TFunction>
+		TimerHandle scheduleEvery(const std::chrono::duration<TRep, TPeriod> &, TFunction &&);
+		size_t pendingTimers() const;
+
+#if LIBFTPP_COROUTINES
+		/*
+		** `co_await pool.schedule()` resumes the coroutine on a worker;
+		** `co_await pool.sleepFor(delay)` resumes it on a worker once the
+		** delay has elapsed, without holding a thread meanwhile. If the pool
+		** shuts down first, both throw std::system_error(ECANCELED).
+		*/
+		class ScheduleAwaitable
+		{
+			public:
+				explicit ScheduleAwaitable(WorkerPool &) noexcept;
+				bool await_ready() const noexcept;
+				void await_suspend(std::coroutine_handle<>);
+				void await_resume() const;
+
+			private:
+				WorkerPool &_pool;
+				int _error;
+		};
+
+		class DelayAwaitable
+		{
+			public:
+				DelayAwaitable(WorkerPool &, TimerQueue::Clock::duration) noexcept;
+				bool await_ready() const noexcept;
+				void await_suspend(std::coroutine_handle<>);
+				void await_resume() const;
+
+			private:
+				WorkerPool &_pool;
+				TimerQueue::Clock::duration _delay;
+				int _error;
+		};
+
+		/*
+		** Job owning a suspended coroutine. When dropped without running
+		** (shutdown, stopped timers), it stores ECANCELED in *error, if
+		** given, and resumes the coroutine inline so the frame is not lost.
+		*/
+		class ResumeJob
+		{
+			public:
+				ResumeJob(std::coroutine_handle<>, int *) noexcept;
+				ResumeJob(const ResumeJob &) = delete;
+				ResumeJob(ResumeJob &&) noexcept;
+				ResumeJob &operator=(const ResumeJob &) = delete;
+				ResumeJob &operator=(ResumeJob &&) = delete;
+				~ResumeJob() noexcept;
+
+				void operator()();
+
+			private:
+				std::coroutine_handle<> _handle;
+				int *_error;
+		};
+
+		ScheduleAwaitable schedule() noexcept;
+		template <typename TRep, typename TPeriod>
+		DelayAwaitable sleepFor(const std::chrono::duration<TRep, TPeriod> &) noexcept;
+#endif
+
+		void waitAll();
+
+		const Config &getConfig() const noexcept;
+		size_t size() const noexcept;
+		bool isElastic() const noexcept;
+		Stats stats() const;
+		bool isWorkerThread() const noexcept;
 
 	private:
+		template <typename> friend class Future;
+		friend class TaskGraph;
+		friend struct WorkerPoolNodeDepot;
+		friend struct WorkerPoolNodeCache;
+
+		/*
+		** Jobs travel through the scheduler as intrusive nodes recycled by a
+		** per-thread cache backed by a shared depot, so steady-state
+		** submission does not allocate.
+		*/
+		struct JobNode
+		{
+			Job job;
+			JobNode *next;
+			uint64_t enqueuedAt;
+		};
+
+		/*
+		** Each worker owns a Chase-Lev deque: jobs submitted from inside a job
+		** are pushed there and popped LIFO, idle workers steal FIFO from the
+		** other end. Jobs from outside the pool go through _injectQueue.
+		** Slots are allocated up front for maxWorkers so thieves can scan
+		** them without locking; inactive slots simply have empty deques.
+		*/
+		struct Worker
+		{
+			struct alignas(64) Metrics
+			{
+				LatencyHistogram wait;
+				LatencyHistogram execution;
+				std::atomic<uint64_t> jobsCompleted{0};
+				std::atomic<uint64_t> busyTicks{0};
+				std::atomic<uint64_t> startTick{0};
+			};
+
+			WorkStealingDeque<JobNode *> deque;
+			std::thread thread;
+			bool active = false;
+			Metrics metrics;
+		};
+
+		class InjectQueue
+		{
+			public:
+				void push(JobNode *) noexcept;
+				JobNode *pop() noexcept;
+				bool oldest(uint64_t &) noexcept;
+
+			private:
+				std::mutex _mutex;
+				JobNode *_head = nullptr;
+				JobNode *_tail = nullptr;
+		};
+
+		Config _config;
+		size_t _spinLimit;
+		size_t _yieldLimit;
+
 		std::atomic<bool> _running;
-		std::vector<std::thread> _workers;
-		ThreadSafeQueue<std::function<void()>> _jobQueue;
+		std::vector<std::unique_ptr<Worker>> _workers;
+		InjectQueue _injectQueue;
+		std::atomic<int64_t> _pendingJobs;
+		std::atomic<int64_t> _unfinishedJobs;
+		std::atomic<size_t> _idleWaiters;
+		std::mutex _idleMutex;
+		std::condition_variable _idleCondition;
+
+		std::mutex _parkMutex;
+		std::condition_variable _parkCondition;
+		std::atomic<size_t> _sleepers;
+
+		bool _elastic;
+		mutable std::mutex _resizeMutex;
+		std::atomic<size_t> _activeWorkers;
+		std::atomic<size_t> _peakWorkers;
+		std::atomic<size_t> _grown;
+		std::atomic<size_t> _retired;
+		std::chrono::steady_clock::time_point _lastGrowth;
+		std::thread _supervisor;
+		std::mutex _supervisorMutex;
+		std::condition_variable _supervisorCondition;
+		std::atomic<bool> _supervisorIdle;
 
-		void workerRoutine();
+		std::unique_ptr<TimerQueue> _timers;
+		mutable std::mutex _timersMutex;
+
+		static JobNode *acquireNode();
+		static void releaseNode(JobNode *) noexcept;
+
+		void enqueue(Job &&);
+		void workerRoutine(size_t);
+		bool runPendingJob();
+		JobNode *findJob();
+		bool idle(size_t &);
+		bool park();
+		void wakeOne();
+		void startWorker(size_t);
+		void shutdown() noexcept;
+		bool grow();
+		bool tryRetire();
+		bool shouldGrow();
+		void supervisorRoutine();
+		TimerQueue &timers();
 };
 
+#include "../../srcs/threading/worker_pool.tpp"
+#include "../../srcs/threading/future.tpp"
+
 #endif
\ No newline at end of file
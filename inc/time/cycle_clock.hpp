@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cycle_clock.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:25:35 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:46:27 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CYCLE_CLOCK_HPP
+# define CYCLE_CLOCK_HPP
+
+#include <cstdint>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <x86intrin.h>
+#endif
+
+/*
+ * CycleClock is a cheap monotonic tick source for hot-path instrumentation.
+ * On x86 it reads the time-stamp counter (a few ns per read); elsewhere it
+ * falls back to steady_clock nanoseconds. Ticks are converted to time with
+ * a ratio calibrated once against steady_clock on first use.
+ */
+class CycleClock
+{
+	public:
+		CycleClock() = delete;
+
+		static inline uint64_t now() noexcept
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+#else
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+		}
+
+		static double ticksPerNanosecond() noexcept;
+		static double toNanoseconds(uint64_t) noexcept;
+		static uint64_t fromDuration(std::chrono::nanoseconds) noexcept;
+
+		/*
+		 * Reads both clocks at once so that ticks taken near it can be turned
+		 * into system_clock time; refresh it regularly to bound drift.
+		 */
+		struct WallAnchor
+		{
+			WallAnchor() noexcept;
+			std::chrono::system_clock::time_point toWallClock(uint64_t) const noexcept;
+
+			std::chrono::system_clock::time_point wall;
+			uint64_t ticks;
+		};
+};
+
+#endif
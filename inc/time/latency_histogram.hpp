@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency_histogram.hpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:25:35 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:25:35 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LATENCY_HISTOGRAM_HPP
+# define LATENCY_HISTOGRAM_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+/*
+ * Log-linear histogram of tick counts: each power of two is split into
+ * four buckets, so any recorded value is known within 12.5%. record() is
+ * meant for a single writer (plain relaxed loads and stores, no RMW) and
+ * snapshot() may run concurrently from any thread.
+ * Snapshots convert ticks to nanoseconds with the given ratio.
+ */
+class LatencyHistogram
+{
+	public:
+		static constexpr size_t BucketCount = 256;
+
+		struct Snapshot
+		{
+			std::array<uint64_t, BucketCount> buckets{};
+			uint64_t count = 0;
+			double sum = 0;
+			double max = 0;
+			double ticksPerNanosecond = 1.0;
+
+			void merge(const Snapshot &) noexcept;
+			double mean() const noexcept;
+			double percentile(double) const noexcept;
+		};
+
+		LatencyHistogram() noexcept;
+		LatencyHistogram(const LatencyHistogram &) = delete;
+		LatencyHistogram &operator=(const LatencyHistogram &) = delete;
+
+		inline void record(uint64_t value) noexcept
+		{
+			std::atomic<uint64_t> &bucket = _buckets[bucketIndex(value)];
+
+			bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			_count.store(_count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			_sum.store(_sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+			if (value > _max.load(std::memory_order_relaxed))
+				_max.store(value, std::memory_order_relaxed);
+		}
+
+		Snapshot snapshot(double ticksPerNanosecond = 1.0) const noexcept;
+
+		static inline size_t bucketIndex(uint64_t value) noexcept
+		{
+			if (value < 4)
+				return static_cast<size_t>(value);
+			size_t msb = 63 - static_cast<size_t>(__builtin_clzll(value));
+			return (msb - 1) * 4 + static_cast<size_t>((value >> (msb - 2)) & 3);
+		}
+
+		static uint64_t bucketLowerBound(size_t) noexcept;
+
+	private:
+		std::array<std::atomic<uint64_t>, BucketCount> _buckets;
+		std::atomic<uint64_t> _count;
+		std::atomic<uint64_t> _sum;
+		std::atomic<uint64_t> _max;
+};
+
+#endif
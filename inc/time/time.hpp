@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/12 16:42:14 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/13 14:56:24 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 00:06:54 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,5 +15,8 @@
 
 #include "chronometer.hpp"
 #include "timer.hpp"
+#include "cycle_clock.hpp"
+#include "latency_histogram.hpp"
+#include "timestamp_formatter.hpp"
 
 #endif
\ No newline at end of file
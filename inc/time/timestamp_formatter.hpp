@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timestamp_formatter.hpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:02:47 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 00:02:47 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TIMESTAMP_FORMATTER_HPP
+# define TIMESTAMP_FORMATTER_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/*
+ * Formats system_clock time points as local "YYYY-MM-DD HH:MM:SS", with
+ * ".mmm" or ".uuuuuu" appended at the higher precisions. The text up to
+ * the second goes through localtime_r once per second and is cached; each
+ * call only copies it and writes the sub-second digits. An instance is not
+ * thread-safe: keep one per sink or per thread, or use perThread().
+ */
+class TimestampFormatter
+{
+	public:
+		enum class Precision
+		{
+			SECONDS,
+			MILLISECONDS,
+			MICROSECONDS
+		};
+
+		static constexpr size_t MaxLength = 26;
+
+		explicit TimestampFormatter(Precision = Precision::MILLISECONDS) noexcept;
+
+		// Writes at most MaxLength characters, no terminator; returns the length
+		size_t format(std::chrono::system_clock::time_point, char *) noexcept;
+		void append(std::string &, std::chrono::system_clock::time_point);
+		Precision precision() const noexcept;
+
+		// Millisecond formatter owned by the calling thread
+		static TimestampFormatter &perThread() noexcept;
+
+	private:
+		Precision _precision;
+		int64_t _cachedSecond;
+		char _cachedText[20];
+};
+
+#endif
@@ -0,0 +1,157 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   binary_log.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:39:29 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 01:02:39 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BINARY_LOG_HPP
+# define BINARY_LOG_HPP
+
+#include "logger.hpp"
+#include "log_format.hpp"
+#include "../time/cycle_clock.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <thread>
+
+/*
+** LOG_BIN_* take a format string with "{}" placeholders and its arguments.
+** The call site's format, level, source and argument types live in a
+** static descriptor; a call only copies the raw argument bytes into a
+** per-thread buffer. The placeholder count is checked at compile time.
+*/
+#define LIBFTPP_LOG_BIN(logger, level, format, ...) do { \
+		if constexpr (static_cast<int>(level) >= LIBFTPP_LOG_MIN_LEVEL) { \
+			using libftppArgs_ = decltype(Log::argList(__VA_ARGS__)); \
+			static_assert(Log::placeholderCount(format) == libftppArgs_::size, "Log format placeholders do not match the arguments"); \
+			static constexpr Log::FormatSite libftppSite_{format, level, Log::Source{__FILE__, __LINE__, __func__}, libftppArgs_::types, libftppArgs_::size}; \
+			auto &&libftppLogger_ = (logger); \
+			if (libftppLogger_.shoudLog(level)) \
+				Log::BinaryLog::write(libftppLogger_, libftppSite_, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+#define LOG_BIN_DEBUG(logger, format, ...) LIBFTPP_LOG_BIN(logger, Log::LogLevel::DEBUG, format, ##__VA_ARGS__)
+#define LOG_BIN_TRACE(logger, format, ...) LIBFTPP_LOG_BIN(logger, Log::LogLevel::TRACE, format, ##__VA_ARGS__)
+#define LOG_BIN_INFO(logger, format, ...) LIBFTPP_LOG_BIN(logger, Log::LogLevel::INFO, format, ##__VA_ARGS__)
+#define LOG_BIN_WARNING(logger, format, ...) LIBFTPP_LOG_BIN(logger, Log::LogLevel::WARNING, format, ##__VA_ARGS__)
+#define LOG_BIN_ERROR(logger, format, ...) LIBFTPP_LOG_BIN(logger, Log::LogLevel::ERROR, format, ##__VA_ARGS__)
+#define LOG_BIN_CRITICAL(logger, format, ...) LIBFTPP_LOG_BIN(logger, Log::LogLevel::CRITICAL, format, ##__VA_ARGS__)
+
+namespace Log {
+
+	struct FormatSite
+	{
+		const char *format;
+		LogLevel level;
+		Source source;
+		const ArgType *types;
+		size_t argCount;
+	};
+
+	/*
+	** Deferred formatting backend for LOG_BIN_*. Each thread appends entries
+	** (descriptor, logger, CycleClock ticks, argument bytes) to its own
+	** single-producer ring; one background thread polls the rings.
+	**
+	** Without a path, the background thread renders each entry and hands
+	** the record to its logger's sinks. With a path it appends the raw
+	** entries to that file instead, plus each descriptor and logger name
+	** the first time it is seen; decode() (and tools/ftpp_logdecode) turn
+	** such a file back into text. Entries from one thread stay in order;
+	** across threads they are only ordered within a polling pass.
+	**
+	** A full ring drops the entry (DROP_NEWEST, counted) or makes the caller
+	** wait (BLOCK). While the backend is stopped, LOG_BIN_* format on the
+	** calling thread and log synchronously.
+	*/
+	class BinaryLog
+	{
+		public:
+			struct Config
+			{
+				size_t bufferSize = 1 << 20;						// per thread
+				OverflowPolicy overflow = OverflowPolicy::DROP_NEWEST;
+				std::string path;
+				std::chrono::microseconds pollInterval{500};
+			};
+
+			BinaryLog() = delete;
+
+			static void start();
+			static void start(const Config &);
+			static void stop();
+			static bool isRunning() noexcept;
+			static void flush();
+			static uint64_t droppedEntries() noexcept;
+
+			template <typename... TArgs>
+			static void write(Logger &, const FormatSite &, const TArgs &...);
+
+			static void release(Logger *);
+			static void decode(std::istream &, std::ostream &);
+
+		private:
+			struct Backend;
+			struct RetireOnExit;
+
+			struct EntryHeader
+			{
+				uint32_t size;										// whole entry, 8-byte aligned; 0 marks a wrap
+				uint32_t argBytes;
+				const FormatSite *site;
+				Logger *logger;
+				uint64_t ticks;
+			};
+
+			struct ThreadBuffer
+			{
+				explicit ThreadBuffer(size_t);
+				~ThreadBuffer();
+
+				char *reserve(size_t, OverflowPolicy) noexcept;
+				void commit() noexcept;
+
+				char *data;
+				size_t mask;
+				std::thread::id owner;
+
+				// Producer side
+				alignas(64) std::atomic<size_t> head;
+				std::atomic<bool> writing;							// between the _running check and commit
+				size_t pending;
+				size_t cachedTail;
+				std::atomic<uint64_t> dropped;
+
+				// Consumer side
+				alignas(64) std::atomic<size_t> tail;
+				std::atomic<bool> retired;
+			};
+
+			static inline std::atomic<bool> _running{false};
+			static inline std::atomic<OverflowPolicy> _overflow{OverflowPolicy::DROP_NEWEST};
+			static inline thread_local ThreadBuffer *_threadBuffer = nullptr;
+
+			static Backend &backend();
+			static ThreadBuffer *registerThread();
+			static void writeInline(Logger &, const FormatSite &, const char *);
+			static void consumerRoutine();
+	};
+
+}
+
+#include "../../srcs/utilities/binary_log.tpp"
+
+#endif
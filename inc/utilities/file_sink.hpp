@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   file_sink.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:27:33 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 00:48:27 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FILE_SINK_HPP
+# define FILE_SINK_HPP
+
+#include "logger.hpp"
+#include "../time/timestamp_formatter.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Log {
+
+	enum class FsyncPolicy
+	{
+		NEVER,
+		PERIODIC,
+		EVERY_WRITE
+	};
+
+	/*
+	** Appends formatted records to a file opened with O_APPEND.
+	**
+	** write() formats into a large in-memory buffer under a short lock; full
+	** buffers go to a background I/O thread that writes them with writev(2),
+	** rotates the file and calls fdatasync(2). Callers only wait when every
+	** buffer is queued behind the disk.
+	**
+	** flush() is cheap because the Logger calls it after every record: it
+	** marks the buffer for writing within flushInterval. sync() blocks until
+	** everything written so far is in the file (and on disk, unless fsync
+	** is NEVER). A failed fdatasync still releases sync() and counts in
+	** writeErrors().
+	**
+	** Rotation renames path to path.1, path.1 to path.2 and so on up to
+	** maxFiles, then reopens path; it happens on the I/O thread between two
+	** writes, so no record is split across files.
+	*/
+	class FileSink : public Sink
+	{
+		public:
+			static constexpr size_t BufferCount = 4;
+
+			struct Config
+			{
+				size_t bufferSize = 1 << 20;
+				std::chrono::milliseconds flushInterval{50};
+				size_t rotateSize = 0;									// bytes, 0 disables
+				std::chrono::seconds rotateInterval{0};					// 0 disables
+				size_t maxFiles = 5;
+				size_t preallocate = 0;									// bytes reserved with fallocate per file
+				FsyncPolicy fsync = FsyncPolicy::NEVER;
+				std::chrono::milliseconds fsyncInterval{1000};
+			};
+
+			explicit FileSink(const std::string &);
+			FileSink(const std::string &, const Config &);
+			FileSink(const FileSink &) = delete;
+			FileSink &operator=(const FileSink &) = delete;
+			~FileSink() override;
+
+			void write(const Record &) override;
+			void flush() override;
+			void set_level(LogLevel) override;
+
+			void sync();
+
+			const std::string &path() const noexcept;
+			uint64_t bytesWritten() const noexcept;
+			uint64_t rotations() const noexcept;
+			uint64_t writeErrors() const noexcept;
+
+		private:
+			std::string _path;
+			Config _config;
+			std::atomic<LogLevel> _level;
+
+			std::mutex _mutex;
+			std::condition_variable _ioCondition;
+			std::condition_variable _spaceCondition;
+			std::condition_variable _syncCondition;
+			std::string _active;
+			size_t _activeRecords;
+			std::deque<std::string> _full;
+			std::vector<std::string> _spare;
+			bool _dirty;
+			bool _ioIdle;
+			bool _stopping;
+			uint64_t _accepted;
+			uint64_t _syncTarget;
+			uint64_t _synced;
+
+			TimestampFormatter _timestamps;
+
+			// Owned by the I/O thread
+			int _fd;
+			size_t _fileSize;
+			std::chrono::steady_clock::time_point _openedAt;
+			std::chrono::steady_clock::time_point _lastFsync;
+
+			std::atomic<uint64_t> _bytesWritten;
+			std::atomic<uint64_t> _rotations;
+			std::atomic<uint64_t> _writeErrors;
+			std::thread _thread;
+
+			void format(const Record &);
+			void handOff();
+			bool openFile();
+			void rotate();
+			bool rotationDue(size_t) const;
+			bool fsyncDue(bool, bool) const;
+			void writeBatch(std::vector<std::string> &);
+			void ioRoutine();
+	};
+
+}
+
+#endif
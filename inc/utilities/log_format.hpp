@@ -0,0 +1,183 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_format.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:38:05 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:59:24 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG_FORMAT_HPP
+# define LOG_FORMAT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/*
+** Argument encoding shared by the format-string logging paths. Arguments
+** are reduced to a handful of wire types, copied as raw bytes by the
+** caller and rendered into "{}" placeholders later, possibly on another
+** thread or in another process. "{{" and "}}" stand for literal braces.
+*/
+namespace Log {
+
+	enum class ArgType : uint8_t
+	{
+		BOOL,
+		CHAR,
+		INT,
+		UINT,
+		DOUBLE,
+		STRING,
+		POINTER
+	};
+
+	static constexpr size_t BadFormat = static_cast<size_t>(-1);
+
+	// Number of placeholders, or BadFormat for an unmatched brace
+	constexpr size_t placeholderCount(std::string_view format) noexcept
+	{
+		size_t count = 0;
+
+		for (size_t i = 0; i < format.size(); ++i) {
+			if (format[i] == '{') {
+				if (i + 1 < format.size() && format[i + 1] == '{')
+					++i;
+				else if (i + 1 < format.size() && format[i + 1] == '}') {
+					++count;
+					++i;
+				} else
+					return BadFormat;
+			} else if (format[i] == '}') {
+				if (i + 1 < format.size() && format[i + 1] == '}')
+					++i;
+				else
+					return BadFormat;
+			}
+		}
+		return count;
+	}
+
+	template <typename TType>
+	struct DependentFalse : std::false_type {};
+
+	template <typename TType, typename = void>
+	struct ArgTraits
+	{
+		static_assert(DependentFalse<TType>::value, "Unsupported log argument type");
+	};
+
+	template <typename TType>
+	struct ArgTraits<TType, std::enable_if_t<std::is_same_v<TType, bool>>>
+	{
+		static constexpr ArgType type = ArgType::BOOL;
+		using Wire = bool;
+	};
+
+	template <typename TType>
+	struct ArgTraits<TType, std::enable_if_t<std::is_same_v<TType, char>>>
+	{
+		static constexpr ArgType type = ArgType::CHAR;
+		using Wire = char;
+	};
+
+	template <typename TType>
+	struct ArgTraits<TType, std::enable_if_t<(std::is_integral_v<TType> && std::is_signed_v<TType> && !std::is_same_v<TType, char>)
+											 || std::is_enum_v<TType>>>
+	{
+		static constexpr ArgType type = ArgType::INT;
+		using Wire = int64_t;
+	};
+
+	template <typename TType>
+	struct ArgTraits<TType, std::enable_if_t<std::is_integral_v<TType> && std::is_unsigned_v<TType> && !std::is_same_v<TType, bool>
+											 && !std::is_same_v<TType, char>>>
+	{
+		static constexpr ArgType type = ArgType::UINT;
+		using Wire = uint64_t;
+	};
+
+	template <typename TType>
+	struct ArgTraits<TType, std::enable_if_t<std::is_floating_point_v<TType>>>
+	{
+		static constexpr ArgType type = ArgType::DOUBLE;
+		using Wire = double;
+	};
+
+	template <typename TType>
+	struct ArgTraits<TType, std::enable_if_t<std::is_same_v<TType, std::string> || std::is_same_v<TType, std::string_view>
+											 || std::is_same_v<TType, const char *> || std::is_same_v<TType, char *>>>
+	{
+		static constexpr ArgType type = ArgType::STRING;
+		using Wire = std::string_view;
+	};
+
+	template <typename TType>
+	struct ArgTraits<TType, std::enable_if_t<std::is_pointer_v<TType> && !std::is_same_v<TType, const char *>
+											 && !std::is_same_v<TType, char *>>>
+	{
+		static constexpr ArgType type = ArgType::POINTER;
+		using Wire = uintptr_t;
+	};
+
+	template <typename TType>
+	using ArgTraitsOf = ArgTraits<std::remove_cv_t<std::decay_t<TType>>>;
+
+	// The wire types of an argument pack, for per-call-site descriptors
+	template <typename... TArgs>
+	struct ArgList
+	{
+		static constexpr size_t size = sizeof...(TArgs);
+		static constexpr ArgType types[sizeof...(TArgs) + 1] = {ArgTraitsOf<TArgs>::type..., ArgType::BOOL};
+	};
+
+	// Only used in unevaluated context to name the ArgList of a call
+	template <typename... TArgs>
+	ArgList<std::decay_t<TArgs>...> argList(const TArgs &...);
+
+	template <typename... TArgs>
+	size_t encodedSize(const TArgs &...) noexcept;
+
+	template <typename... TArgs>
+	char *encodeArgs(char *, const TArgs &...) noexcept;
+
+	/*
+	** Appends format to out with each placeholder replaced by the next
+	** encoded argument; returns the end of the arguments it consumed.
+	*/
+	const char *renderFormat(std::string &out, std::string_view format, const ArgType *types, size_t count, const char *args);
+
+	/*
+	** Same output as renderFormat, straight from the arguments. Nothing is
+	** allocated once out has the capacity for the result.
+	*/
+	template <typename... TArgs>
+	void formatTo(std::string &out, std::string_view format, const TArgs &...);
+
+	namespace Detail {
+
+		// Appends the literal text from position up to the next placeholder; false when there is none
+		bool appendLiteral(std::string &out, std::string_view format, size_t &position);
+
+		void appendValue(std::string &out, bool);
+		void appendValue(std::string &out, char);
+		void appendValue(std::string &out, int64_t);
+		void appendValue(std::string &out, uint64_t);
+		void appendValue(std::string &out, double);
+		void appendValue(std::string &out, std::string_view);
+		void appendPointer(std::string &out, uintptr_t);
+
+	}
+
+}
+
+#include "../../srcs/utilities/log_format.tpp"
+
+#endif
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_sampling.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:11:22 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 00:11:22 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG_SAMPLING_HPP
+# define LOG_SAMPLING_HPP
+
+#include "logger.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+/*
+** Sampled variants of the LOG_* macros, with the level given by name:
+**   LOG_EVERY_N(logger, WARNING, 1000, "queue full: {}", depth);
+**   LOG_FIRST_N(logger, INFO, 10, "using fallback path");
+**   LOG_RATE_LIMITED(logger, ERROR, 100, "request {} failed", id);
+** Each statement keeps its state in a static sampler of its own. The
+** level is checked first, so filtered calls use no budget. The sampling
+** check is a few relaxed atomic operations: it never takes a lock.
+** Suppressed calls do not evaluate the message or its arguments. A
+** summary record at the same level and source reports what was dropped.
+** The count and rate are read on every call and may change at run time.
+*/
+#define LIBFTPP_LOG_SAMPLED(logger, level, sampler, limit, ...) do { \
+		if constexpr (static_cast<int>(level) >= LIBFTPP_LOG_MIN_LEVEL) { \
+			static sampler libftppSampler_; \
+			auto &&libftppSampledLogger_ = (logger); \
+			if (libftppSampledLogger_.shoudLog(level)) { \
+				Log::Admission libftppAdmission_ = libftppSampler_.admit(limit); \
+				if (libftppAdmission_.summary) \
+					libftppSampledLogger_.logFormat((level), Log::Source{__FILE__, __LINE__, __func__}, \
+													sampler::SummaryFormat, libftppAdmission_.summary); \
+				if (libftppAdmission_.admitted) \
+					LIBFTPP_LOG(libftppSampledLogger_, level, __VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
+#define LOG_EVERY_N(logger, level, n, ...) LIBFTPP_LOG_SAMPLED(logger, Log::LogLevel::level, Log::EveryN, n, __VA_ARGS__)
+#define LOG_FIRST_N(logger, level, n, ...) LIBFTPP_LOG_SAMPLED(logger, Log::LogLevel::level, Log::FirstN, n, __VA_ARGS__)
+#define LOG_RATE_LIMITED(logger, level, perSecond, ...) \
+	LIBFTPP_LOG_SAMPLED(logger, Log::LogLevel::level, Log::RateLimiter, perSecond, __VA_ARGS__)
+
+namespace Log {
+
+	// Whether this call logs, and the value of a summary record to emit first (0 for none)
+	struct Admission
+	{
+		bool admitted;
+		uint64_t summary;
+	};
+
+	// Calls 1, n + 1, 2n + 1, ... log; the rest are dropped without a summary
+	class EveryN
+	{
+		public:
+			static constexpr const char *SummaryFormat = "";
+
+			constexpr EveryN() noexcept : _calls(0) {}
+
+			inline Admission admit(uint64_t n) noexcept
+			{
+				uint64_t call = _calls.fetch_add(1, std::memory_order_relaxed);
+
+				return Admission{n <= 1 || call % n == 0, 0};
+			}
+
+		private:
+			std::atomic<uint64_t> _calls;
+	};
+
+	/*
+	** The first n calls log. The next one emits a single summary saying the
+	** site is now quiet; after that a call costs one relaxed load.
+	*/
+	class FirstN
+	{
+		public:
+			static constexpr const char *SummaryFormat = "Logged the first {} messages from here; suppressing the rest";
+
+			constexpr FirstN() noexcept : _calls(0) {}
+
+			inline Admission admit(uint64_t n) noexcept
+			{
+				if (_calls.load(std::memory_order_relaxed) > n)
+					return Admission{false, 0};
+
+				uint64_t call = _calls.fetch_add(1, std::memory_order_relaxed);
+				return Admission{call < n, call == n ? n : 0};
+			}
+
+		private:
+			std::atomic<uint64_t> _calls;
+	};
+
+	/*
+	** At most perSecond calls log per one-second window of the monotonic
+	** clock. Windows are fixed, so a burst straddling a boundary can reach
+	** twice the rate. The window and the calls seen in it share one word;
+	** the call that opens a new window logs the summary of the previous
+	** active window.
+	*/
+	class RateLimiter
+	{
+		public:
+			static constexpr const char *SummaryFormat = "Suppressed {} messages from here over the rate limit";
+
+			constexpr RateLimiter() noexcept : _state(0) {}
+
+			Admission admit(uint64_t perSecond) noexcept;
+
+		private:
+			std::atomic<uint64_t> _state;
+
+			static uint64_t currentWindow() noexcept;
+	};
+
+}
+
+#endif
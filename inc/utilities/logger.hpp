@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/14 12:51:49 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/18 18:24:07 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 00:56:02 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,13 +20,61 @@
 #include <thread>
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <memory>
+#include <cstdint>
 
-#define LOG_DEBUG(logger, msg) do { (logger).log(Log::LogLevel::DEBUG, (msg), Log::Source{__FILE__, __LINE__, __func__});} while (0)
-#define LOG_TRACE(logger, msg) do { (logger).log(Log::LogLevel::TRACE, (msg), Log::Source{__FILE__, __LINE__, __func__});} while (0)
-#define LOG_INFO(logger, msg) do { (logger).log(Log::LogLevel::INFO, (msg), Log::Source{__FILE__, __LINE__, __func__});} while (0)
-#define LOG_WARNING(logger, msg) do { (logger).log(Log::LogLevel::WARNING, (msg), Log::Source{__FILE__, __LINE__, __func__});} while (0)
-#define LOG_ERROR(logger, msg) do { (logger).log(Log::LogLevel::ERROR, (msg), Log::Source{__FILE__, __LINE__, __func__});} while (0)
-#define LOG_CRITICAL(logger, msg) do { (logger).log(Log::LogLevel::CRITICAL, (msg), Log::Source{__FILE__, __LINE__, __func__});} while (0)
+#include "log_format.hpp"
+
+/*
+** The LOG_* macros evaluate their message only when the level passes: a
+** filtered statement costs one relaxed load. Statements below
+** LIBFTPP_LOG_MIN_LEVEL (0 DEBUG ... 5 CRITICAL, 6 disables everything)
+** compile to nothing, but their arguments must still typecheck.
+**
+** LOG_INFO(logger, message) logs a string as is. With further arguments
+** the second one is a format string literal: LOG_INFO(logger, "user {}
+** took {} ms", id, ms). Its placeholders are counted at compile time and
+** the arguments are written with to_chars into a per-thread buffer, so
+** common argument types do not allocate. Up to 16 arguments.
+*/
+#ifndef LIBFTPP_LOG_MIN_LEVEL
+# define LIBFTPP_LOG_MIN_LEVEL 0
+#endif
+
+#define LIBFTPP_LOG_MESSAGE(logger, level, msg) do { \
+		if constexpr (static_cast<int>(level) >= LIBFTPP_LOG_MIN_LEVEL) { \
+			auto &&libftppLogger_ = (logger); \
+			if (libftppLogger_.shoudLog(level)) \
+				libftppLogger_.log((level), (msg), Log::Source{__FILE__, __LINE__, __func__}); \
+		} \
+	} while (0)
+
+#define LIBFTPP_LOG_FORMAT(logger, level, format, ...) do { \
+		if constexpr (static_cast<int>(level) >= LIBFTPP_LOG_MIN_LEVEL) { \
+			static_assert(Log::placeholderCount(format) == decltype(Log::argList(__VA_ARGS__))::size, \
+						  "Log format placeholders do not match the arguments"); \
+			auto &&libftppLogger_ = (logger); \
+			if (libftppLogger_.shoudLog(level)) \
+				libftppLogger_.logFormat((level), Log::Source{__FILE__, __LINE__, __func__}, (format), __VA_ARGS__); \
+		} \
+	} while (0)
+
+// Picks LIBFTPP_LOG_MESSAGE for a single argument, LIBFTPP_LOG_FORMAT otherwise
+#define LIBFTPP_LOG_PICK(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, name, ...) name
+#define LIBFTPP_LOG(logger, level, ...) LIBFTPP_LOG_PICK(__VA_ARGS__, \
+		LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, \
+		LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, \
+		LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, \
+		LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, LIBFTPP_LOG_FORMAT, \
+		LIBFTPP_LOG_MESSAGE, )(logger, level, __VA_ARGS__)
+
+#define LOG_DEBUG(logger, ...) LIBFTPP_LOG(logger, Log::LogLevel::DEBUG, __VA_ARGS__)
+#define LOG_TRACE(logger, ...) LIBFTPP_LOG(logger, Log::LogLevel::TRACE, __VA_ARGS__)
+#define LOG_INFO(logger, ...) LIBFTPP_LOG(logger, Log::LogLevel::INFO, __VA_ARGS__)
+#define LOG_WARNING(logger, ...) LIBFTPP_LOG(logger, Log::LogLevel::WARNING, __VA_ARGS__)
+#define LOG_ERROR(logger, ...) LIBFTPP_LOG(logger, Log::LogLevel::ERROR, __VA_ARGS__)
+#define LOG_CRITICAL(logger, ...) LIBFTPP_LOG(logger, Log::LogLevel::CRITICAL, __VA_ARGS__)
 
 namespace fs = std::filesystem;
 using time_point = std::chrono::system_clock::time_point;
@@ -60,6 +108,8 @@ namespace Log {
 		std::thread::id threadId;
 	};
 
+	const char *levelName(LogLevel) noexcept;
+
 	struct Sink 
 	{
 		virtual ~Sink() = default;
@@ -68,15 +118,39 @@ namespace Log {
 		virtual void set_level(LogLevel) = 0;
 	};
 
+	enum class OverflowPolicy
+	{
+		BLOCK,
+		DROP_NEWEST,
+		DROP_OLDEST
+	};
+
+	struct AsyncConfig
+	{
+		size_t capacity = 8192;
+		OverflowPolicy overflow = OverflowPolicy::BLOCK;
+		size_t batchSize = 256;
+	};
+
+	/*
+	** By default log() formats a Record and hands it to every sink on the
+	** calling thread. startAsync() switches to a preallocated ring drained
+	** by a background thread: callers only copy the record into a slot, and
+	** the sink thread writes batches and flushes each sink once per batch.
+	** When the ring is full the overflow policy blocks the caller, drops the
+	** new record or drops the oldest queued one; drops are counted.
+	*/
+	class BinaryLog;
+
 	class Logger
 	{
 		public:
 			
 			Logger() = delete;
 			Logger(const std::string &);
-			Logger(Logger &&) noexcept;
+			Logger(Logger &&);
 			Logger &operator=(const Logger &) = delete;
-			Logger &operator=(Logger &&) noexcept;
+			Logger &operator=(Logger &&);
 			~Logger();
 
 			void setName(const std::string &);
@@ -87,16 +161,48 @@ namespace Log {
 			void clearSinks();
 			
 			void setLogLevel(LogLevel);
-			bool shoudLog(LogLevel) const;
+			inline bool shoudLog(LogLevel level) const noexcept
+			{
+				return _logLevel.load(std::memory_order_relaxed) <= level;
+			}
+
 			void log(LogLevel , const std::string &, const Source &);
+			template <typename... TArgs>
+			void logFormat(LogLevel, const Source &, std::string_view, const TArgs &...);
+			void dispatch(Record &);
+
+			void startAsync(const AsyncConfig & = AsyncConfig());
+			void stopAsync();
+			bool isAsync() const noexcept;
+			void flush();
+			uint64_t droppedRecords() const;
 
 		private:
+			friend class BinaryLog;
+			struct AsyncState;
+
 			mutable std::mutex _mutex;
 			
 			std::string _name;
-			LogLevel _logLevel;
+			std::atomic<LogLevel> _logLevel;
 			std::vector<Sink *> _sinks;
+
+			// Sinks and name as seen by the sink thread; writers hold both locks
+			std::mutex _sinkMutex;
+			std::atomic<AsyncState *> _asyncState;
+			std::vector<std::unique_ptr<AsyncState>> _asyncStates;
+
+			// Set once LOG_BIN_* has queued an entry for this logger
+			std::atomic<bool> _deferred;
+
+			void push(AsyncState &, LogLevel, const std::string &, const Source &);
+			void deliver(std::vector<Record> &, size_t);
+			void sinkRoutine(AsyncState &);
+			void drainInline(AsyncState &);
 	};
 
 }
+
+#include "../../srcs/utilities/logger.tpp"
+
 #endif
\ No newline at end of file
@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/14 12:51:16 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/14 18:16:47 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 00:14:39 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,6 +14,10 @@
 # define UTILITIES_HPP
 
 #include "logger.hpp"
+#include "file_sink.hpp"
+#include "log_format.hpp"
+#include "binary_log.hpp"
+#include "log_sampling.hpp"
 #include "csv.hpp"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,256 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   io_reactor.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:38:19 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 02:41:52 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/network/io_reactor.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <unistd.h>
+#if defined(__linux__)
+# include <sys/epoll.h>
+# include <sys/eventfd.h>
+#endif
+
+namespace
+{
+	const int MAX_EVENTS = 128;
+
+	void throwError(const std::string &what)
+	{
+		throw std::runtime_error(what + ": " + std::strerror(errno));
+	}
+}
+
+/* Public Methods */
+
+#if defined(__linux__)
+
+IoReactor::IoReactor(WorkerPool &pool) : _pool(pool), _epoll(-1), _wakeFd(-1), _running(true)
+{
+	struct epoll_event event;
+
+	_epoll = epoll_create1(EPOLL_CLOEXEC);
+	if (_epoll < 0)
+		throwError("Failed to create epoll instance");
+	_wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (_wakeFd < 0) {
+		close(_epoll);
+		throwError("Failed to create eventfd");
+	}
+
+	std::memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.fd = _wakeFd;
+	if (epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeFd, &event) < 0) {
+		close(_wakeFd);
+		close(_epoll);
+		throwError("Failed to register eventfd");
+	}
+	_thread = std::thread(&IoReactor::run, this);
+}
+
+/*
+** Pending callbacks are dropped without running. Suspended coroutines are
+** resumed on the pool with ECANCELED instead, so their frames are not lost;
+** if the pool cannot take the job, the coroutine is resumed inline.
+*/
+IoReactor::~IoReactor() noexcept
+{
+	uint64_t one = 1;
+
+	_running.store(false);
+	if (::write(_wakeFd, &one, sizeof(one)) < 0) {
+		// The counter cannot overflow here; nothing to recover
+	}
+	if (_thread.joinable())
+		_thread.join();
+	close(_wakeFd);
+	close(_epoll);
+
+	for (auto &entry : _waiters) {
+		for (Waiter *waiter : {&entry.second.read, &entry.second.write}) {
+			if (!waiter->job || !waiter->error)
+				continue;
+			*waiter->error = ECANCELED;
+			auto resume = std::make_shared<Job>(std::move(waiter->job));
+			try {
+				_pool.addJob([resume]() { (*resume)(); });
+			} catch (...) {
+				(*resume)();
+			}
+		}
+	}
+}
+
+void IoReactor::watch(int fd, Interest interest, Job &&callback)
+{
+	addWaiter(fd, interest, std::move(callback), nullptr);
+}
+
+/*
+** Stops watching fd (call before closing it). Pending callbacks run
+** immediately so that suspended coroutines are not lost.
+*/
+void IoReactor::cancel(int fd)
+{
+	Waiters waiters;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		auto it = _waiters.find(fd);
+		if (it == _waiters.end())
+			return;
+		waiters = std::move(it->second);
+		_waiters.erase(it);
+		epoll_ctl(_epoll, EPOLL_CTL_DEL, fd, nullptr);
+	}
+	if (waiters.read.job)
+		_pool.addJob(std::move(waiters.read.job));
+	if (waiters.write.job)
+		_pool.addJob(std::move(waiters.write.job));
+}
+
+size_t IoReactor::watched() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	return _waiters.size();
+}
+
+/* Private Methods */
+
+void IoReactor::addWaiter(int fd, Interest interest, Job &&callback, int *error)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	Waiters &waiters = _waiters[fd];
+	Waiter &slot = interest == Interest::READ ? waiters.read : waiters.write;
+
+	if (slot.job)
+		throw std::runtime_error("File descriptor already has a pending waiter");
+	slot.job = std::move(callback);
+	slot.error = error;
+	try {
+		arm(fd, waiters);
+	} catch (...) {
+		slot.job.reset();
+		if (!waiters.read.job && !waiters.write.job)
+			_waiters.erase(fd);
+		throw;
+	}
+}
+
+void IoReactor::run()
+{
+	struct epoll_event events[MAX_EVENTS];
+	std::vector<Job> ready;
+
+	while (_running.load()) {
+		int count = epoll_wait(_epoll, events, MAX_EVENTS, -1);
+		if (count < 0) {
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			for (int i = 0; i < count; i++) {
+				int fd = events[i].data.fd;
+				uint32_t flags = events[i].events;
+
+				if (fd == _wakeFd)
+					continue;
+				auto it = _waiters.find(fd);
+				if (it == _waiters.end())
+					continue;
+
+				Waiters &waiters = it->second;
+				if (waiters.read.job && (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)))
+					ready.push_back(std::move(waiters.read.job));
+				if (waiters.write.job && (flags & (EPOLLOUT | EPOLLHUP | EPOLLERR)))
+					ready.push_back(std::move(waiters.write.job));
+
+				if (!waiters.read.job && !waiters.write.job) {
+					// Stays registered but disarmed (one-shot) until the next watch
+					_waiters.erase(it);
+				} else {
+					try {
+						arm(fd, waiters);
+					} catch (const std::exception &e) {
+						threadSafeCout << "IoReactor failed to re-arm fd " << fd << ": " << e.what() << std::endl;
+					}
+				}
+			}
+		}
+
+		for (Job &job : ready)
+			_pool.addJob(std::move(job));
+		ready.clear();
+	}
+}
+
+/*
+** Caller holds _mutex. Registrations are one-shot and re-armed with the
+** union of the remaining interests.
+*/
+void IoReactor::arm(int fd, const Waiters &waiters)
+{
+	struct epoll_event event;
+
+	std::memset(&event, 0, sizeof(event));
+	event.events = EPOLLONESHOT | EPOLLRDHUP;
+	if (waiters.read.job)
+		event.events |= EPOLLIN;
+	if (waiters.write.job)
+		event.events |= EPOLLOUT;
+	event.data.fd = fd;
+
+	if (epoll_ctl(_epoll, EPOLL_CTL_MOD, fd, &event) == 0)
+		return;
+	if (errno == ENOENT && epoll_ctl(_epoll, EPOLL_CTL_ADD, fd, &event) == 0)
+		return;
+	throwError("Failed to watch file descriptor");
+}
+
+#else
+
+IoReactor::IoReactor(WorkerPool &pool) : _pool(pool), _epoll(-1), _wakeFd(-1), _running(false)
+{
+	throw std::runtime_error("IoReactor requires epoll (Linux)");
+}
+
+IoReactor::~IoReactor() noexcept
+{
+}
+
+void IoReactor::watch(int, Interest, Job &&)
+{
+	throw std::runtime_error("IoReactor requires epoll (Linux)");
+}
+
+void IoReactor::addWaiter(int, Interest, Job &&, int *)
+{
+	throw std::runtime_error("IoReactor requires epoll (Linux)");
+}
+
+void IoReactor::cancel(int)
+{
+}
+
+size_t IoReactor::watched() const
+{
+	return 0;
+}
+
+#endif
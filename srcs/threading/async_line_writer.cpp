@@ -0,0 +1,262 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   async_line_writer.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:01:12 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:01:12 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/threading/async_line_writer.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <vector>
+#include <poll.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+constexpr size_t AsyncLineWriter::BatchLines;
+
+struct AsyncLineWriter::FlushRequest
+{
+	bool done = false;
+};
+
+AsyncLineWriter::AsyncLineWriter(int fd) : _fd(fd), _head(allocate(0)), _tail(_head), _sleeping(false), _stopping(false), _linesWritten(0), _writeCalls(0)
+{
+}
+
+/*
+** Lines still queued (submitted while the writer was stopping, or never
+** started) are written by the destroying thread.
+*/
+AsyncLineWriter::~AsyncLineWriter() noexcept
+{
+	stop();
+	drain(false);
+	release(_head);
+}
+
+void AsyncLineWriter::start()
+{
+	std::lock_guard<std::mutex> lock(_stateMutex);
+
+	if (_thread.joinable())
+		return;
+	_stopping.store(false);
+	_thread = std::thread(&AsyncLineWriter::writerRoutine, this);
+}
+
+/*
+** Writes everything queued so far, then joins the writer thread.
+*/
+void AsyncLineWriter::stop()
+{
+	std::lock_guard<std::mutex> lock(_stateMutex);
+
+	if (!_thread.joinable())
+		return;
+	{
+		std::lock_guard<std::mutex> wakeLock(_wakeMutex);
+		_stopping.store(true);
+	}
+	_wakeCondition.notify_one();
+	_thread.join();
+}
+
+bool AsyncLineWriter::isRunning() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_stateMutex);
+	return _thread.joinable();
+}
+
+void AsyncLineWriter::submit(const char *text, size_t size)
+{
+	Node *node = allocate(size);
+
+	std::memcpy(node->text(), text, size);
+	push(node);
+}
+
+/*
+** A marker node travels through the queue behind every line submitted
+** before this call; the writer signals it once those lines are written.
+** Without a writer thread the caller drains the queue itself.
+*/
+void AsyncLineWriter::flush()
+{
+	std::unique_lock<std::mutex> stateLock(_stateMutex);
+
+	if (!_thread.joinable()) {
+		drain(false);
+		return;
+	}
+	stateLock.unlock();
+
+	FlushRequest request;
+	Node *marker = allocate(0);
+	marker->flush = &request;
+	push(marker);
+
+	std::unique_lock<std::mutex> lock(_flushMutex);
+	_flushCondition.wait(lock, [&]() { return request.done; });
+}
+
+uint64_t AsyncLineWriter::linesWritten() const noexcept
+{
+	return _linesWritten.load(std::memory_order_relaxed);
+}
+
+uint64_t AsyncLineWriter::writeCalls() const noexcept
+{
+	return _writeCalls.load(std::memory_order_relaxed);
+}
+
+/* Private Methods */
+
+char *AsyncLineWriter::Node::text() noexcept
+{
+	return reinterpret_cast<char *>(this + 1);
+}
+
+// Header and text share one allocation
+AsyncLineWriter::Node *AsyncLineWriter::allocate(size_t size)
+{
+	void *memory = ::operator new(sizeof(Node) + size);
+	Node *node = new (memory) Node;
+
+	node->next.store(nullptr, std::memory_order_relaxed);
+	node->size = size;
+	node->flush = nullptr;
+	return node;
+}
+
+void AsyncLineWriter::release(Node *node) noexcept
+{
+	node->~Node();
+	::operator delete(node);
+}
+
+/*
+** Vyukov MPSC push. The seq_cst link store pairs with the writer's
+** seq_cst _sleeping store: either the writer sees the line or we see it
+** asleep and wake it.
+*/
+void AsyncLineWriter::push(Node *node) noexcept
+{
+	Node *previous = _tail.exchange(node, std::memory_order_acq_rel);
+	previous->next.store(node);
+
+	if (_sleeping.load()) {
+		std::lock_guard<std::mutex> lock(_wakeMutex);
+		_wakeCondition.notify_one();
+	}
+}
+
+/*
+** Writes queued lines in batches until the queue is empty. _head is the
+** last consumed node and stays allocated as the queue stub; nodes before
+** it are freed once their batch is written. Returns false if nothing was
+** queued. A push caught between its exchange and its link is waited for
+** when waitForLinks is set, and left for the next call otherwise.
+*/
+bool AsyncLineWriter::drain(bool waitForLinks)
+{
+	std::vector<struct iovec> batch;
+	std::vector<Node *> retired;
+	bool wrote = false;
+
+	batch.reserve(BatchLines);
+	retired.reserve(BatchLines);
+	for (;;) {
+		Node *next = _head->next.load(std::memory_order_acquire);
+
+		if (!next) {
+			if (waitForLinks && _tail.load(std::memory_order_acquire) != _head) {
+				std::this_thread::yield();
+				continue;
+			}
+			break;
+		}
+		retired.push_back(_head);
+		_head = next;
+		wrote = true;
+
+		if (next->flush) {
+			writeAll(batch.data(), batch.size());
+			batch.clear();
+			std::lock_guard<std::mutex> lock(_flushMutex);
+			next->flush->done = true;
+			_flushCondition.notify_all();
+		} else if (next->size) {
+			batch.push_back({next->text(), next->size});
+		}
+		if (batch.size() == BatchLines || next->flush) {
+			writeAll(batch.data(), batch.size());
+			batch.clear();
+			for (Node *node : retired)
+				release(node);
+			retired.clear();
+		}
+	}
+	writeAll(batch.data(), batch.size());
+	for (Node *node : retired)
+		release(node);
+	return wrote;
+}
+
+void AsyncLineWriter::writeAll(struct iovec *iov, size_t count)
+{
+	if (count == 0)
+		return;
+	_linesWritten.fetch_add(count, std::memory_order_relaxed);
+
+	while (count > 0) {
+		ssize_t written = ::writev(_fd, iov, static_cast<int>(count));
+		_writeCalls.fetch_add(1, std::memory_order_relaxed);
+
+		if (written < 0) {
+			if (errno == EINTR)
+				continue;
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				struct pollfd descriptor = {_fd, POLLOUT, 0};
+				::poll(&descriptor, 1, -1);
+				continue;
+			}
+			return;
+		}
+		// Skip what the kernel took; a partially written line is resumed
+		size_t remaining = static_cast<size_t>(written);
+		while (count > 0 && remaining >= iov->iov_len) {
+			remaining -= iov->iov_len;
+			++iov;
+			--count;
+		}
+		if (count > 0) {
+			iov->iov_base = static_cast<char *>(iov->iov_base) + remaining;
+			iov->iov_len -= remaining;
+		}
+	}
+}
+
+void AsyncLineWriter::writerRoutine()
+{
+	for (;;) {
+		if (drain(true))
+			continue;
+
+		std::unique_lock<std::mutex> lock(_wakeMutex);
+		_sleeping.store(true);
+		_wakeCondition.wait(lock, [&]() {
+			return _head->next.load() != nullptr || _stopping.load();
+		});
+		_sleeping.store(false);
+		if (_stopping.load() && _head->next.load() == nullptr && _tail.load() == _head)
+			return;
+	}
+}
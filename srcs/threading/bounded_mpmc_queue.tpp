@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bounded_mpmc_queue.tpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:15:23 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:15:23 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BOUNDED_MPMC_QUEUE_TPP
+# define BOUNDED_MPMC_QUEUE_TPP
+
+#include <stdexcept>
+
+/* Public Methods */
+
+template <typename TType>
+BoundedMPMCQueue<TType>::BoundedMPMCQueue(size_t capacity) : _mask(roundUp(capacity) - 1), _slots(new Slot[_mask + 1]), _enqueuePos(0), _dequeuePos(0)
+{
+	for (uint64_t i = 0; i <= _mask; ++i)
+		_slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+/*
+** fill(TType &) runs on the claimed slot before it is published; it must
+** not throw.
+*/
+template <typename TType>
+template <typename TFill>
+bool BoundedMPMCQueue<TType>::tryPushWith(TFill &&fill)
+{
+	uint64_t position = _enqueuePos.load(std::memory_order_relaxed);
+
+	for (;;) {
+		Slot &slot = _slots[position & _mask];
+		uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+		int64_t difference = static_cast<int64_t>(sequence - position);
+
+		if (difference == 0) {
+			if (_enqueuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+				fill(slot.value);
+				slot.sequence.store(position + 1, std::memory_order_release);
+				return true;
+			}
+		} else if (difference < 0) {
+			return false;
+		} else {
+			position = _enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+/*
+** consume(TType &) sees the slot in place; whatever it leaves behind is
+** what the next push into that slot starts from.
+*/
+template <typename TType>
+template <typename TConsume>
+bool BoundedMPMCQueue<TType>::tryPopWith(TConsume &&consume)
+{
+	uint64_t position = _dequeuePos.load(std::memory_order_relaxed);
+
+	for (;;) {
+		Slot &slot = _slots[position & _mask];
+		uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+		int64_t difference = static_cast<int64_t>(sequence - (position + 1));
+
+		if (difference == 0) {
+			if (_dequeuePos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+				consume(slot.value);
+				slot.sequence.store(position + _mask + 1, std::memory_order_release);
+				return true;
+			}
+		} else if (difference < 0) {
+			return false;
+		} else {
+			position = _dequeuePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+template <typename TType>
+bool BoundedMPMCQueue<TType>::tryPush(const TType &value)
+{
+	return tryPushWith([&value](TType &slot) { slot = value; });
+}
+
+template <typename TType>
+bool BoundedMPMCQueue<TType>::tryPop(TType &value)
+{
+	return tryPopWith([&value](TType &slot) { value = std::move(slot); });
+}
+
+template <typename TType>
+size_t BoundedMPMCQueue<TType>::capacity() const noexcept
+{
+	return static_cast<size_t>(_mask + 1);
+}
+
+template <typename TType>
+size_t BoundedMPMCQueue<TType>::sizeApprox() const noexcept
+{
+	uint64_t dequeued = _dequeuePos.load(std::memory_order_acquire);
+	uint64_t enqueued = _enqueuePos.load(std::memory_order_acquire);
+
+	return enqueued > dequeued ? static_cast<size_t>(enqueued - dequeued) : 0;
+}
+
+// Positions claimed so far, including pushes still filling their slot
+template <typename TType>
+uint64_t BoundedMPMCQueue<TType>::pushed() const noexcept
+{
+	return _enqueuePos.load(std::memory_order_acquire);
+}
+
+template <typename TType>
+uint64_t BoundedMPMCQueue<TType>::popped() const noexcept
+{
+	return _dequeuePos.load(std::memory_order_acquire);
+}
+
+/* Private Methods */
+
+template <typename TType>
+uint64_t BoundedMPMCQueue<TType>::roundUp(size_t capacity)
+{
+	if (capacity < 2)
+		throw std::runtime_error("BoundedMPMCQueue capacity must be at least 2");
+
+	uint64_t rounded = 2;
+	while (rounded < capacity)
+		rounded <<= 1;
+	return rounded;
+}
+
+#endif
@@ -0,0 +1,215 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_priority_queue.tpp                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 21:56:05 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 02:18:36 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef CONCURRENT_PRIORITY_QUEUE_TPP
+# define CONCURRENT_PRIORITY_QUEUE_TPP
+
+/* Public Methods */
+
+template <typename TType, typename TPriority>
+ConcurrentPriorityQueue<TType, TPriority>::ConcurrentPriorityQueue() : ConcurrentPriorityQueue(std::max<size_t>(2, std::thread::hardware_concurrency() * 2))
+{
+}
+
+template <typename TType, typename TPriority>
+ConcurrentPriorityQueue<TType, TPriority>::ConcurrentPriorityQueue(size_t shards) : _shards(new Shard[shards ? shards : 1]), _shardCount(shards ? shards : 1), _size(0), _waiters(0), _closed(false)
+{
+}
+
+template <typename TType, typename TPriority>
+void ConcurrentPriorityQueue<TType, TPriority>::push(TPriority priority, const TType &value)
+{
+	pushImpl(priority, value);
+}
+
+template <typename TType, typename TPriority>
+void ConcurrentPriorityQueue<TType, TPriority>::push(TPriority priority, TType &&value)
+{
+	pushImpl(priority, std::move(value));
+}
+
+template <typename TType, typename TPriority>
+bool ConcurrentPriorityQueue<TType, TPriority>::pop(TType &value)
+{
+	while (true) {
+		if (tryPop(value))
+			return true;
+		if (_closed.load() && _size.load() == 0)
+			return false;
+
+		std::unique_lock<std::mutex> lock(_waitMutex);
+		_waiters.fetch_add(1);
+		_cv.wait(lock, [this]() { return _size.load() > 0 || _closed.load(); });
+		_waiters.fetch_sub(1);
+	}
+}
+
+template <typename TType, typename TPriority>
+bool ConcurrentPriorityQueue<TType, TPriority>::tryPop(TType &value)
+{
+	if (_size.load() == 0)
+		return false;
+
+	// Two-choice sampling: compare the published tops of two random shards
+	for (size_t attempt = 0; attempt < _shardCount; attempt++) {
+		Shard &a = _shards[randomIndex()];
+		Shard &b = _shards[randomIndex()];
+		bool aHas = a.hasItems.load(std::memory_order_acquire);
+		bool bHas = b.hasItems.load(std::memory_order_acquire);
+		if (!aHas && !bHas)
+			continue;
+
+		Shard *best = &a;
+		if (!aHas || (bHas && b.top.load(std::memory_order_relaxed) > a.top.load(std::memory_order_relaxed)))
+			best = &b;
+
+		std::unique_lock<std::mutex> lock(best->mutex, std::try_to_lock);
+		if (lock.owns_lock() && popFromShard(*best, value))
+			return true;
+	}
+
+	// Sampling kept missing: sweep every shard so a non-empty queue never reports empty
+	for (size_t i = 0; i < _shardCount; i++) {
+		std::lock_guard<std::mutex> lock(_shards[i].mutex);
+		if (popFromShard(_shards[i], value))
+			return true;
+	}
+	return false;
+}
+
+template <typename TType, typename TPriority>
+void ConcurrentPriorityQueue<TType, TPriority>::close() noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(_waitMutex);
+		_closed.store(true);
+	}
+	_cv.notify_all();
+}
+
+template <typename TType, typename TPriority>
+bool ConcurrentPriorityQueue<TType, TPriority>::isClosed() const noexcept
+{
+	return _closed.load();
+}
+
+template <typename TType, typename TPriority>
+void ConcurrentPriorityQueue<TType, TPriority>::clear() noexcept
+{
+	for (size_t i = 0; i < _shardCount; i++) {
+		std::lock_guard<std::mutex> lock(_shards[i].mutex);
+		_size.fetch_sub(_shards[i].heap.size());
+		_shards[i].heap.clear();
+		publishTop(_shards[i]);
+	}
+}
+
+template <typename TType, typename TPriority>
+bool ConcurrentPriorityQueue<TType, TPriority>::empty() const noexcept
+{
+	return _size.load() == 0;
+}
+
+template <typename TType, typename TPriority>
+size_t ConcurrentPriorityQueue<TType, TPriority>::size() const noexcept
+{
+	return _size.load();
+}
+
+template <typename TType, typename TPriority>
+size_t ConcurrentPriorityQueue<TType, TPriority>::shardCount() const noexcept
+{
+	return _shardCount;
+}
+
+/* Private Methods */
+
+template <typename TType, typename TPriority>
+bool ConcurrentPriorityQueue<TType, TPriority>::EntryCompare::operator()(const Entry &a, const Entry &b) const noexcept
+{
+	if (a.priority != b.priority)
+		return a.priority < b.priority;
+	return a.sequence > b.sequence;
+}
+
+template <typename TType, typename TPriority>
+template <typename TValue>
+void ConcurrentPriorityQueue<TType, TPriority>::pushImpl(TPriority priority, TValue &&value)
+{
+	if (_closed.load())
+		throw std::runtime_error("Queue is closed");
+
+	size_t index = randomIndex();
+	while (true) {
+		Shard &shard = _shards[index];
+		std::unique_lock<std::mutex> lock(shard.mutex, std::try_to_lock);
+		if (!lock.owns_lock()) {
+			index = (index + 1) % _shardCount;
+			continue;
+		}
+		shard.heap.push_back(Entry{priority, shard.sequence++, std::forward<TValue>(value)});
+		std::push_heap(shard.heap.begin(), shard.heap.end(), EntryCompare());
+		// Counted under the shard lock, before the entry is visible, so a
+		// concurrent pop can never decrement _size below zero
+		_size.fetch_add(1);
+		publishTop(shard);
+		break;
+	}
+
+	notifyOne();
+}
+
+template <typename TType, typename TPriority>
+bool ConcurrentPriorityQueue<TType, TPriority>::popFromShard(Shard &shard, TType &value)
+{
+	if (shard.heap.empty())
+		return false;
+
+	std::pop_heap(shard.heap.begin(), shard.heap.end(), EntryCompare());
+	value = std::move(shard.heap.back().value);
+	shard.heap.pop_back();
+	publishTop(shard);
+	_size.fetch_sub(1);
+	return true;
+}
+
+template <typename TType, typename TPriority>
+void ConcurrentPriorityQueue<TType, TPriority>::publishTop(Shard &shard) noexcept
+{
+	if (!shard.heap.empty())
+		shard.top.store(shard.heap.front().priority, std::memory_order_relaxed);
+	shard.hasItems.store(!shard.heap.empty(), std::memory_order_release);
+}
+
+template <typename TType, typename TPriority>
+void ConcurrentPriorityQueue<TType, TPriority>::notifyOne()
+{
+	// Paired with the waiter's _waiters increment: both sides use seq_cst
+	// so either the pusher sees the waiter or the waiter sees the new size.
+	if (_waiters.load() > 0) {
+		std::lock_guard<std::mutex> lock(_waitMutex);
+		_cv.notify_one();
+	}
+}
+
+template <typename TType, typename TPriority>
+size_t ConcurrentPriorityQueue<TType, TPriority>::randomIndex() const noexcept
+{
+	thread_local uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return static_cast<size_t>(state % _shardCount);
+}
+
+#endif
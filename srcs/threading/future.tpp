@@ -0,0 +1,401 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   future.tpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:04:15 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 00:36:04 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FUTURE_TPP
+# define FUTURE_TPP
+
+/*#############################################################################
+# FutureDetail::State implementation
+#############################################################################*/
+
+template <typename TType>
+FutureDetail::State<TType>::State() noexcept : _ready(false)
+{
+}
+
+template <typename TType>
+void FutureDetail::State<TType>::setValue(Stored<TType> &&value)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	if (_ready.load())
+		throw std::runtime_error("Future already satisfied");
+	_value.emplace(std::move(value));
+	markReady(lock);
+}
+
+template <typename TType>
+void FutureDetail::State<TType>::setException(std::exception_ptr exception)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	if (_ready.load())
+		throw std::runtime_error("Future already satisfied");
+	_exception = exception;
+	markReady(lock);
+}
+
+template <typename TType>
+void FutureDetail::State<TType>::abandon() noexcept
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	if (_ready.load())
+		return;
+	_exception = std::make_exception_ptr(std::future_error(std::future_errc::broken_promise));
+	markReady(lock);
+}
+
+template <typename TType>
+void FutureDetail::State<TType>::onReady(std::function<void()> callback)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_ready.load()) {
+			_continuations.push_back(std::move(callback));
+			return;
+		}
+	}
+	callback();
+}
+
+template <typename TType>
+bool FutureDetail::State<TType>::isReady() const noexcept
+{
+	return _ready.load(std::memory_order_acquire);
+}
+
+template <typename TType>
+void FutureDetail::State<TType>::wait() const
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_condition.wait(lock, [this]() { return _ready.load(); });
+}
+
+template <typename TType>
+bool FutureDetail::State<TType>::waitFor(std::chrono::nanoseconds timeout) const
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	return _condition.wait_for(lock, timeout, [this]() { return _ready.load(); });
+}
+
+template <typename TType>
+FutureDetail::Stored<TType> FutureDetail::State<TType>::take()
+{
+	wait();
+	if (_exception)
+		std::rethrow_exception(_exception);
+	return std::move(*_value);
+}
+
+template <typename TType>
+void FutureDetail::State<TType>::markReady(std::unique_lock<std::mutex> &lock)
+{
+	std::vector<std::function<void()>> continuations;
+
+	continuations.swap(_continuations);
+	_ready.store(true, std::memory_order_release);
+	lock.unlock();
+	_condition.notify_all();
+
+	for (auto &continuation : continuations)
+		continuation();
+}
+
+template <typename TType, typename TFunction>
+void FutureDetail::fulfill(State<TType> &state, TFunction &&function)
+{
+	try {
+		if constexpr (std::is_void<TType>::value) {
+			function();
+			state.setValue(VoidValue());
+		} else {
+			state.setValue(function());
+		}
+	} catch (...) {
+		state.setException(std::current_exception());
+	}
+}
+
+template <typename TType>
+std::shared_ptr<FutureDetail::State<TType>> &FutureDetail::Access::state(Future<TType> &future) noexcept
+{
+	return future._state;
+}
+
+template <typename TType>
+std::shared_ptr<FutureDetail::State<TType>> &FutureDetail::Access::state(Promise<TType> &promise) noexcept
+{
+	return promise._state;
+}
+
+template <typename TType>
+WorkerPool *FutureDetail::Access::pool(const Future<TType> &future) noexcept
+{
+	return future._pool;
+}
+
+/*#############################################################################
+# Future class implementation
+#############################################################################*/
+
+/* Public Methods */
+
+template <typename TType>
+Future<TType>::Future() noexcept : _state(nullptr), _pool(nullptr)
+{
+}
+
+template <typename TType>
+Future<TType>::Future(std::shared_ptr<FutureDetail::State<TType>> state, WorkerPool *pool) noexcept : _state(std::move(state)), _pool(pool)
+{
+}
+
+template <typename TType>
+Future<TType>::Future(Future &&other) noexcept : _state(std::move(other._state)), _pool(other._pool)
+{
+	other._pool = nullptr;
+}
+
+template <typename TType>
+Future<TType> &Future<TType>::operator=(Future &&other) noexcept
+{
+	if (this != &other) {
+		_state = std::move(other._state);
+		_pool = other._pool;
+		other._pool = nullptr;
+	}
+	return *this;
+}
+
+template <typename TType>
+bool Future<TType>::valid() const noexcept
+{
+	return _state != nullptr;
+}
+
+template <typename TType>
+bool Future<TType>::isReady() const
+{
+	checkValid();
+	return _state->isReady();
+}
+
+template <typename TType>
+void Future<TType>::wait() const
+{
+	checkValid();
+	if (_pool && _pool->isWorkerThread()) {
+		// Help the pool instead of blocking one of its threads
+		while (!_state->isReady()) {
+			if (!_pool->runPendingJob())
+				_state->waitFor(std::chrono::microseconds(50));
+		}
+		return;
+	}
+	_state->wait();
+}
+
+template <typename TType>
+TType Future<TType>::get()
+{
+	wait();
+
+	std::shared_ptr<FutureDetail::State<TType>> state = std::move(_state);
+	if constexpr (std::is_void<TType>::value)
+		state->take();
+	else
+		return state->take();
+}
+
+template <typename TType>
+template <typename TFunction>
+Future<typename FutureDetail::ContinuationResult<TType, TFunction>::type> Future<TType>::then(TFunction &&function)
+{
+	using TResult = typename FutureDetail::ContinuationResult<TType, TFunction>::type;
+
+	checkValid();
+
+	// Shared so that a continuation dropped by a stopping pool breaks the promise
+	auto source = std::move(_state);
+	auto target = std::make_shared<Promise<TResult>>();
+	auto continuation = std::make_shared<typename std::decay<TFunction>::type>(std::forward<TFunction>(function));
+	WorkerPool *pool = _pool;
+
+	auto run = [source, target, continuation]() {
+		FutureDetail::fulfill(*FutureDetail::Access::state(*target), [&]() -> TResult {
+			if constexpr (std::is_void<TType>::value) {
+				source->take();
+				return (*continuation)();
+			} else {
+				return (*continuation)(source->take());
+			}
+		});
+	};
+
+	source->onReady([pool, run]() {
+		if (pool)
+			pool->addJob(run);
+		else
+			run();
+	});
+	return target->getFuture(pool);
+}
+
+/* Private Methods */
+
+template <typename TType>
+void Future<TType>::checkValid() const
+{
+	if (!_state)
+		throw std::runtime_error("Future has no shared state");
+}
+
+/*#############################################################################
+# Promise class implementation
+#############################################################################*/
+
+template <typename TType>
+Promise<TType>::Promise() : _state(std::make_shared<FutureDetail::State<TType>>())
+{
+}
+
+template <typename TType>
+Promise<TType> &Promise<TType>::operator=(Promise &&other) noexcept
+{
+	if (this != &other) {
+		if (_state)
+			_state->abandon();
+		_state = std::move(other._state);
+	}
+	return *this;
+}
+
+template <typename TType>
+Promise<TType>::~Promise() noexcept
+{
+	if (_state)
+		_state->abandon();
+}
+
+template <typename TType>
+Future<TType> Promise<TType>::getFuture(WorkerPool *pool)
+{
+	return Future<TType>(_state, pool);
+}
+
+template <typename TType>
+template <typename TValue>
+void Promise<TType>::setValue(TValue &&value)
+{
+	_state->setValue(FutureDetail::Stored<TType>(std::forward<TValue>(value)));
+}
+
+template <typename TType>
+void Promise<TType>::setValue()
+{
+	_state->setValue(FutureDetail::Stored<TType>());
+}
+
+template <typename TType>
+void Promise<TType>::setException(std::exception_ptr exception)
+{
+	_state->setException(exception);
+}
+
+/*#############################################################################
+# Combinators
+#############################################################################*/
+
+template <typename TType>
+Future<std::vector<TType>> whenAll(std::vector<Future<TType>> futures)
+{
+	auto target = std::make_shared<FutureDetail::State<std::vector<TType>>>();
+	auto sources = std::make_shared<std::vector<std::shared_ptr<FutureDetail::State<TType>>>>();
+	auto remaining = std::make_shared<std::atomic<size_t>>(futures.size());
+	WorkerPool *pool = futures.empty() ? nullptr : FutureDetail::Access::pool(futures.front());
+
+	for (auto &future : futures)
+		sources->push_back(std::move(FutureDetail::Access::state(future)));
+
+	auto collect = [target, sources]() {
+		FutureDetail::fulfill(*target, [&]() {
+			std::vector<TType> values;
+			values.reserve(sources->size());
+			for (auto &source : *sources)
+				values.push_back(source->take());
+			return values;
+		});
+	};
+
+	if (sources->empty())
+		collect();
+	for (auto &source : *sources) {
+		source->onReady([remaining, collect]() {
+			if (remaining->fetch_sub(1) == 1)
+				collect();
+		});
+	}
+	return Future<std::vector<TType>>(target, pool);
+}
+
+inline Future<void> whenAll(std::vector<Future<void>> futures)
+{
+	auto target = std::make_shared<FutureDetail::State<void>>();
+	auto sources = std::make_shared<std::vector<std::shared_ptr<FutureDetail::State<void>>>>();
+	auto remaining = std::make_shared<std::atomic<size_t>>(futures.size());
+	WorkerPool *pool = futures.empty() ? nullptr : FutureDetail::Access::pool(futures.front());
+
+	for (auto &future : futures)
+		sources->push_back(std::move(FutureDetail::Access::state(future)));
+
+	auto collect = [target, sources]() {
+		FutureDetail::fulfill(*target, [&]() {
+			for (auto &source : *sources)
+				source->take();
+		});
+	};
+
+	if (sources->empty())
+		collect();
+	for (auto &source : *sources) {
+		source->onReady([remaining, collect]() {
+			if (remaining->fetch_sub(1) == 1)
+				collect();
+		});
+	}
+	return Future<void>(target, pool);
+}
+
+template <typename TType>
+Future<WhenAnyResult<TType>> whenAny(std::vector<Future<TType>> futures)
+{
+	if (futures.empty())
+		throw std::runtime_error("whenAny requires at least one future");
+
+	auto target = std::make_shared<FutureDetail::State<WhenAnyResult<TType>>>();
+	auto claimed = std::make_shared<std::atomic<bool>>(false);
+	WorkerPool *pool = FutureDetail::Access::pool(futures.front());
+	std::vector<std::shared_ptr<FutureDetail::State<TType>>> sources;
+
+	// Callbacks may fire during registration and move the inputs away
+	for (auto &future : futures)
+		sources.push_back(FutureDetail::Access::state(future));
+	auto inputs = std::make_shared<std::vector<Future<TType>>>(std::move(futures));
+
+	for (size_t i = 0; i < sources.size(); i++) {
+		sources[i]->onReady([target, inputs, claimed, i]() {
+			if (!claimed->exchange(true))
+				target->setValue(WhenAnyResult<TType>{i, std::move(*inputs)});
+		});
+	}
+	return Future<WhenAnyResult<TType>>(target, pool);
+}
+
+#endif
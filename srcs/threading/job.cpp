@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job.cpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:10:04 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:10:04 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/threading/job.hpp"
+
+/* Public Methods */
+
+Job::Job() noexcept : _operations(nullptr)
+{
+}
+
+Job::Job(std::nullptr_t) noexcept : _operations(nullptr)
+{
+}
+
+Job::Job(Job &&other) noexcept : _operations(other._operations)
+{
+	if (_operations) {
+		_operations->move(_storage, other._storage);
+		other._operations = nullptr;
+	}
+}
+
+Job &Job::operator=(Job &&other) noexcept
+{
+	if (this != &other) {
+		reset();
+		if (other._operations) {
+			other._operations->move(_storage, other._storage);
+			_operations = other._operations;
+			other._operations = nullptr;
+		}
+	}
+	return *this;
+}
+
+Job::~Job() noexcept
+{
+	reset();
+}
+
+void Job::operator()()
+{
+	if (!_operations)
+		throw std::bad_function_call();
+	_operations->invoke(_storage);
+}
+
+Job::operator bool() const noexcept
+{
+	return _operations != nullptr;
+}
+
+bool Job::isInline() const noexcept
+{
+	return _operations && _operations->isInline;
+}
+
+void Job::reset() noexcept
+{
+	if (_operations) {
+		_operations->destroy(_storage);
+		_operations = nullptr;
+	}
+}
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job.tpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:10:04 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:10:04 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef JOB_TPP
+# define JOB_TPP
+
+template <typename TFunction, typename>
+Job::Job(TFunction &&function) : _operations(nullptr)
+{
+	using TStored = typename std::decay<TFunction>::type;
+
+	if constexpr (fitsInline<TStored>()) {
+		new (_storage) TStored(std::forward<TFunction>(function));
+		_operations = &InlineStorage<TStored>::operations;
+	} else {
+		*reinterpret_cast<TStored **>(_storage) = new TStored(std::forward<TFunction>(function));
+		_operations = &HeapStorage<TStored>::operations;
+	}
+}
+
+template <typename TFunction>
+constexpr bool Job::fitsInline()
+{
+	return sizeof(TFunction) <= InlineSize
+		&& alignof(std::max_align_t) % alignof(TFunction) == 0
+		&& std::is_nothrow_move_constructible<TFunction>::value;
+}
+
+/* Inline storage */
+
+template <typename TFunction>
+const Job::Operations Job::InlineStorage<TFunction>::operations = {
+	&Job::InlineStorage<TFunction>::invoke,
+	&Job::InlineStorage<TFunction>::move,
+	&Job::InlineStorage<TFunction>::destroy,
+	true
+};
+
+template <typename TFunction>
+void Job::InlineStorage<TFunction>::invoke(void *storage)
+{
+	(*static_cast<TFunction *>(storage))();
+}
+
+template <typename TFunction>
+void Job::InlineStorage<TFunction>::move(void *destination, void *source) noexcept
+{
+	new (destination) TFunction(std::move(*static_cast<TFunction *>(source)));
+	static_cast<TFunction *>(source)->~TFunction();
+}
+
+template <typename TFunction>
+void Job::InlineStorage<TFunction>::destroy(void *storage) noexcept
+{
+	static_cast<TFunction *>(storage)->~TFunction();
+}
+
+/* Heap storage */
+
+template <typename TFunction>
+const Job::Operations Job::HeapStorage<TFunction>::operations = {
+	&Job::HeapStorage<TFunction>::invoke,
+	&Job::HeapStorage<TFunction>::move,
+	&Job::HeapStorage<TFunction>::destroy,
+	false
+};
+
+template <typename TFunction>
+void Job::HeapStorage<TFunction>::invoke(void *storage)
+{
+	(**static_cast<TFunction **>(storage))();
+}
+
+template <typename TFunction>
+void Job::HeapStorage<TFunction>::move(void *destination, void *source) noexcept
+{
+	*static_cast<TFunction **>(destination) = *static_cast<TFunction **>(source);
+	*static_cast<TFunction **>(source) = nullptr;
+}
+
+template <typename TFunction>
+void Job::HeapStorage<TFunction>::destroy(void *storage) noexcept
+{
+	delete *static_cast<TFunction **>(storage);
+}
+
+#endif
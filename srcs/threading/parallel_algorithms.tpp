@@ -0,0 +1,210 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_algorithms.tpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:06:03 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 02:53:50 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARALLEL_ALGORITHMS_TPP
+# define PARALLEL_ALGORITHMS_TPP
+
+namespace ParallelDetail {
+
+	inline size_t chunkSize(const WorkerPool &pool, size_t count, size_t grain)
+	{
+		if (grain)
+			return grain;
+		size_t chunks = std::max<size_t>(1, pool.size()) * 8;
+		return std::max<size_t>(1, (count + chunks - 1) / chunks);
+	}
+
+	// Runs body(chunkIndex, first, last) for every chunk; the caller runs the
+	// first chunk itself and then waits for the rest. Submitted chunks hold
+	// a reference to body, so they are waited for even if a submit throws.
+	template <typename TBody>
+	void forEachChunk(WorkerPool &pool, size_t count, size_t grain, TBody body)
+	{
+		if (count == 0)
+			return;
+
+		size_t step = chunkSize(pool, count, grain);
+		size_t chunks = (count + step - 1) / step;
+		std::vector<Future<void>> pending;
+		std::exception_ptr error;
+
+		try {
+			pending.reserve(chunks - 1);
+			for (size_t chunk = 1; chunk < chunks; chunk++) {
+				size_t first = chunk * step;
+				size_t last = std::min(count, first + step);
+				pending.push_back(pool.submit([&body, chunk, first, last]() { body(chunk, first, last); }));
+			}
+		} catch (...) {
+			error = std::current_exception();
+		}
+
+		if (!error) {
+			try {
+				body(0, 0, std::min(count, step));
+			} catch (...) {
+				error = std::current_exception();
+			}
+		}
+		for (auto &future : pending) {
+			try {
+				future.get();
+			} catch (...) {
+				if (!error)
+					error = std::current_exception();
+			}
+		}
+		if (error)
+			std::rethrow_exception(error);
+	}
+
+	// Callers sizing per-chunk storage compute the step once and pass it as
+	// the grain of every pass: chunkSize() follows the live pool size.
+	inline size_t chunkCount(size_t count, size_t step)
+	{
+		return count ? (count + step - 1) / step : 0;
+	}
+}
+
+template <typename TIterator, typename TFunction>
+void parallelFor(WorkerPool &pool, TIterator begin, TIterator end, size_t grain, TFunction function)
+{
+	if constexpr (std::is_integral<TIterator>::value) {
+		size_t count = end > begin ? static_cast<size_t>(end - begin) : 0;
+		ParallelDetail::forEachChunk(pool, count, grain, [&](size_t, size_t first, size_t last) {
+			for (size_t i = first; i < last; i++)
+				function(static_cast<TIterator>(begin + i));
+		});
+	} else {
+		size_t count = static_cast<size_t>(std::distance(begin, end));
+		ParallelDetail::forEachChunk(pool, count, grain, [&](size_t, size_t first, size_t last) {
+			TIterator it = std::next(begin, first);
+			for (size_t i = first; i < last; i++, ++it)
+				function(*it);
+		});
+	}
+}
+
+template <typename TIterator, typename TFunction>
+void parallelFor(WorkerPool &pool, TIterator begin, TIterator end, TFunction function)
+{
+	parallelFor(pool, begin, end, 0, function);
+}
+
+template <typename TIterator, typename TValue, typename TBinaryOp>
+TValue parallelReduce(WorkerPool &pool, TIterator begin, TIterator end, TValue init, TBinaryOp op, size_t grain)
+{
+	// Optional so TValue needs no default constructor
+	size_t count = static_cast<size_t>(std::distance(begin, end));
+	size_t step = ParallelDetail::chunkSize(pool, count, grain);
+	std::vector<std::optional<TValue>> partials(ParallelDetail::chunkCount(count, step));
+
+	ParallelDetail::forEachChunk(pool, count, step, [&](size_t chunk, size_t first, size_t last) {
+		TIterator it = std::next(begin, first);
+		TValue partial = *it;
+		for (++it, ++first; first < last; ++it, ++first)
+			partial = op(std::move(partial), *it);
+		partials[chunk].emplace(std::move(partial));
+	});
+
+	for (auto &partial : partials)
+		init = op(std::move(init), std::move(*partial));
+	return init;
+}
+
+template <typename TIterator, typename TValue>
+TValue parallelReduce(WorkerPool &pool, TIterator begin, TIterator end, TValue init)
+{
+	return parallelReduce(pool, begin, end, init, std::plus<TValue>());
+}
+
+template <typename TInputIt, typename TOutputIt, typename TUnaryOp>
+TOutputIt parallelTransform(WorkerPool &pool, TInputIt begin, TInputIt end, TOutputIt out, TUnaryOp op, size_t grain)
+{
+	size_t count = static_cast<size_t>(std::distance(begin, end));
+
+	ParallelDetail::forEachChunk(pool, count, grain, [&](size_t, size_t first, size_t last) {
+		std::transform(std::next(begin, first), std::next(begin, last), std::next(out, first), op);
+	});
+	return std::next(out, count);
+}
+
+template <typename TInputIt, typename TOutputIt, typename TBinaryOp>
+TOutputIt parallelScan(WorkerPool &pool, TInputIt begin, TInputIt end, TOutputIt out, TBinaryOp op, size_t grain)
+{
+	using TValue = typename std::iterator_traits<TInputIt>::value_type;
+
+	size_t count = static_cast<size_t>(std::distance(begin, end));
+	size_t step = ParallelDetail::chunkSize(pool, count, grain);
+	size_t chunks = ParallelDetail::chunkCount(count, step);
+	if (chunks <= 1)
+		return std::partial_sum(begin, end, out, op);
+
+	// Pass 1: scan each chunk locally and remember its total
+	std::vector<std::optional<TValue>> totals(chunks);
+	ParallelDetail::forEachChunk(pool, count, step, [&](size_t chunk, size_t first, size_t last) {
+		TOutputIt chunkEnd = std::partial_sum(std::next(begin, first), std::next(begin, last), std::next(out, first), op);
+		totals[chunk].emplace(*std::prev(chunkEnd));
+	});
+
+	// Serial scan over the chunk totals gives each chunk its carry-in
+	for (size_t chunk = 1; chunk < chunks; chunk++)
+		*totals[chunk] = op(*totals[chunk - 1], *totals[chunk]);
+
+	// Pass 2: apply the carry-in to every chunk but the first
+	ParallelDetail::forEachChunk(pool, count, step, [&](size_t chunk, size_t first, size_t last) {
+		if (chunk == 0)
+			return;
+		const TValue &carry = *totals[chunk - 1];
+		TOutputIt it = std::next(out, first);
+		for (; first < last; ++first, ++it)
+			*it = op(carry, *it);
+	});
+	return std::next(out, count);
+}
+
+template <typename TInputIt, typename TOutputIt>
+TOutputIt parallelScan(WorkerPool &pool, TInputIt begin, TInputIt end, TOutputIt out)
+{
+	return parallelScan(pool, begin, end, out, std::plus<typename std::iterator_traits<TInputIt>::value_type>());
+}
+
+template <typename TIterator, typename TCompare>
+void parallelSort(WorkerPool &pool, TIterator begin, TIterator end, TCompare compare, size_t grain)
+{
+	size_t count = static_cast<size_t>(std::distance(begin, end));
+	size_t step = grain ? grain : std::max<size_t>(4096, count / (std::max<size_t>(1, pool.size()) * 2));
+
+	// Sort runs of `step` elements, then merge neighbouring runs pairwise
+	ParallelDetail::forEachChunk(pool, count, step, [&](size_t, size_t first, size_t last) {
+		std::sort(std::next(begin, first), std::next(begin, last), compare);
+	});
+
+	for (size_t width = step; width < count; width *= 2) {
+		size_t merges = (count + 2 * width - 1) / (2 * width);
+		ParallelDetail::forEachChunk(pool, merges, 1, [&](size_t, size_t first, size_t) {
+			size_t low = first * 2 * width;
+			size_t middle = std::min(count, low + width);
+			size_t high = std::min(count, low + 2 * width);
+			if (middle < high)
+				std::inplace_merge(std::next(begin, low), std::next(begin, middle), std::next(begin, high), compare);
+		});
+	}
+}
+
+template <typename TIterator>
+void parallelSort(WorkerPool &pool, TIterator begin, TIterator end)
+{
+	parallelSort(pool, begin, end, std::less<typename std::iterator_traits<TIterator>::value_type>());
+}
+
+#endif
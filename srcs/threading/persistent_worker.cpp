@@ -6,19 +6,24 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/11 14:50:58 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 16:42:03 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 22:50:51 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../inc/threading/persistent_worker.hpp"
 #include "../../inc/threading/thread_safe_iostream.hpp"
 
-PersistentWorker::PersistentWorker() : _running(true)
+#include <algorithm>
+#include <stdexcept>
+
+constexpr std::chrono::milliseconds PersistentWorker::DefaultPeriod;
+
+PersistentWorker::PersistentWorker() : _running(true), _tasks(std::make_shared<const Snapshot>()), _generation(0)
 {
 	_workerThread = std::thread(&PersistentWorker::workerRoutine, this);
 }
 
-PersistentWorker::PersistentWorker(PersistentWorker &&other) noexcept : _workerThread(std::move(other._workerThread)), _running(other._running.load()), _um_tasks(std::move(other._um_tasks))
+PersistentWorker::PersistentWorker(PersistentWorker &&other) noexcept : _workerThread(std::move(other._workerThread)), _running(other._running.load()), _tasks(other.loadTasks()), _generation(0)
 {
 	other._running.store(false);
 }
@@ -28,7 +33,7 @@ PersistentWorker& PersistentWorker::operator=(PersistentWorker &&other) noexcept
 	if (this != &other) {
 		_workerThread = std::move(other._workerThread);
 		_running.store(other._running.load());
-		_um_tasks = std::move(other._um_tasks);
+		storeTasks(other.loadTasks());
 		other._running.store(false);
 	}
 	return *this;
@@ -36,41 +41,219 @@ PersistentWorker& PersistentWorker::operator=(PersistentWorker &&other) noexcept
 
 PersistentWorker::~PersistentWorker() noexcept
 {
-	_running.store(false);
+	{
+		std::lock_guard<std::mutex> lock(_wakeMutex);
+		_running.store(false);
+	}
+	_wakeCondition.notify_all();
 	if (_workerThread.joinable())
 		_workerThread.join();
 }
 
 void PersistentWorker::addTask(const std::string &name, const std::function<void()> &task)
 {
+	addTask(name, DefaultPeriod, task);
+}
+
+/*
+** A name that is already registered keeps its current task.
+*/
+void PersistentWorker::addTask(const std::string &name, duration period, const std::function<void()> &task)
+{
+	if (period <= duration::zero())
+		throw std::runtime_error("Task period must be positive");
+
 	std::lock_guard<std::mutex> lock(_mutex);
-	_um_tasks.insert({name, task});
+	SnapshotPtr current = loadTasks();
+
+	for (const Task &existing : *current) {
+		if (existing.name == name)
+			return;
+	}
+	auto state = std::make_shared<TaskState>();
+	state->function = task;
+	state->period = period;
+
+	auto next = std::make_shared<Snapshot>();
+	next->reserve(current->size() + 1);
+	*next = *current;
+	next->push_back(Task{name, std::move(state)});
+	storeTasks(std::move(next));
 }
 
 void PersistentWorker::removeTask(const std::string &name)
 {
 	std::lock_guard<std::mutex> lock(_mutex);
-	_um_tasks.erase(name);
+	SnapshotPtr current = loadTasks();
+	auto next = std::make_shared<Snapshot>();
+
+	next->reserve(current->size());
+	for (const Task &existing : *current) {
+		if (existing.name != name)
+			next->push_back(existing);
+	}
+	if (next->size() != current->size())
+		storeTasks(std::move(next));
+}
+
+bool PersistentWorker::hasTask(const std::string &name) const
+{
+	SnapshotPtr tasks = loadTasks();
+
+	for (const Task &task : *tasks) {
+		if (task.name == name)
+			return true;
+	}
+	return false;
+}
+
+size_t PersistentWorker::taskCount() const noexcept
+{
+	return loadTasks()->size();
 }
 
+PersistentWorker::TaskStats PersistentWorker::getStats(const std::string &name) const
+{
+	SnapshotPtr tasks = loadTasks();
+
+	for (const Task &task : *tasks) {
+		if (task.name != name)
+			continue;
+
+		const TaskState &state = *task.state;
+		TaskStats stats;
+		uint64_t runs = state.runs.load(std::memory_order_relaxed);
+
+		stats.period = state.period;
+		stats.runs = runs;
+		stats.overruns = state.overruns.load(std::memory_order_relaxed);
+		stats.meanJitter = duration(runs ? state.jitterSum.load(std::memory_order_relaxed) / static_cast<int64_t>(runs) : 0);
+		stats.maxJitter = duration(state.jitterMax.load(std::memory_order_relaxed));
+		stats.meanDuration = duration(runs ? state.durationSum.load(std::memory_order_relaxed) / static_cast<int64_t>(runs) : 0);
+		stats.maxDuration = duration(state.durationMax.load(std::memory_order_relaxed));
+		return stats;
+	}
+	throw std::runtime_error("Unknown task: " + name);
+}
+
+/* Private Methods */
+
+bool PersistentWorker::Deadline::operator>(const Deadline &other) const noexcept
+{
+	return due > other.due;
+}
+
+/*
+** The shared_ptr atomic free functions keep the member a plain shared_ptr
+** in every language mode; C++20 deprecates them in favour of
+** std::atomic<std::shared_ptr>, which would change the class layout.
+*/
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
+PersistentWorker::SnapshotPtr PersistentWorker::loadTasks() const noexcept
+{
+	return std::atomic_load(&_tasks);
+}
+
+/*
+** Publishing bumps the generation under the wake mutex so a worker
+** sleeping towards a later deadline picks the change up immediately.
+*/
+void PersistentWorker::storeTasks(SnapshotPtr tasks) noexcept
+{
+	std::atomic_store(&_tasks, std::move(tasks));
+	{
+		std::lock_guard<std::mutex> lock(_wakeMutex);
+		_generation.fetch_add(1);
+	}
+	_wakeCondition.notify_one();
+}
+
+#pragma GCC diagnostic pop
+
 void PersistentWorker::workerRoutine()
 {
+	std::vector<Deadline> deadlines;
+	SnapshotPtr tasks;
+	uint64_t seenGeneration = ~uint64_t(0);
+
 	while (_running.load()) {
-		std::unordered_map<std::string, std::function<void()>> copytasks;
-		{
-			std::lock_guard<std::mutex> lock(_mutex);
-			copytasks = _um_tasks;
+		uint64_t generation = _generation.load();
+		if (generation != seenGeneration) {
+			// Load after reading the generation: a newer publish bumps it again
+			tasks = loadTasks();
+			seenGeneration = generation;
+			rebuildDeadlines(*tasks, deadlines, Clock::now());
 		}
 
-		for (const auto &taskPair : copytasks) {
-			try {
-				taskPair.second();
+		{
+			std::unique_lock<std::mutex> lock(_wakeMutex);
+			auto changed = [&]() { return !_running.load() || _generation.load() != seenGeneration; };
+
+			if (deadlines.empty()) {
+				_wakeCondition.wait(lock, changed);
+				continue;
 			}
-			catch (const std::exception &e) {
-				threadSafeCout << "Worker encountered an error: " << e.what() << std::endl;
+			if (deadlines.front().due > Clock::now()) {
+				_wakeCondition.wait_until(lock, deadlines.front().due, changed);
+				continue;
 			}
 		}
 
-		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		std::pop_heap(deadlines.begin(), deadlines.end(), std::greater<Deadline>());
+		TaskState &state = *deadlines.back().state;
+		runTask(state, Clock::now());
+		deadlines.back().due = state.nextDeadline;
+		std::push_heap(deadlines.begin(), deadlines.end(), std::greater<Deadline>());
 	}
-}
\ No newline at end of file
+}
+
+void PersistentWorker::runTask(TaskState &state, Clock::time_point started)
+{
+	int64_t jitter = std::chrono::duration_cast<duration>(started - state.nextDeadline).count();
+
+	try {
+		state.function();
+	} catch (const std::exception &e) {
+		threadSafeCout << "Worker encountered an error: " << e.what() << std::endl;
+	}
+
+	Clock::time_point finished = Clock::now();
+	int64_t elapsed = std::chrono::duration_cast<duration>(finished - started).count();
+	uint64_t runs = state.runs.load(std::memory_order_relaxed);
+
+	state.runs.store(runs + 1, std::memory_order_relaxed);
+	state.jitterSum.store(state.jitterSum.load(std::memory_order_relaxed) + jitter, std::memory_order_relaxed);
+	if (jitter > state.jitterMax.load(std::memory_order_relaxed))
+		state.jitterMax.store(jitter, std::memory_order_relaxed);
+	state.durationSum.store(state.durationSum.load(std::memory_order_relaxed) + elapsed, std::memory_order_relaxed);
+	if (elapsed > state.durationMax.load(std::memory_order_relaxed))
+		state.durationMax.store(elapsed, std::memory_order_relaxed);
+
+	// Fixed rate; ticks already missed are skipped and counted
+	state.nextDeadline += state.period;
+	if (state.nextDeadline <= finished) {
+		auto missed = (finished - state.nextDeadline) / state.period + 1;
+		state.nextDeadline += missed * state.period;
+		state.overruns.store(state.overruns.load(std::memory_order_relaxed) + static_cast<uint64_t>(missed), std::memory_order_relaxed);
+	}
+}
+
+/*
+** Tasks keep their deadline across snapshots; new ones are due now.
+*/
+void PersistentWorker::rebuildDeadlines(const Snapshot &tasks, std::vector<Deadline> &deadlines, Clock::time_point now)
+{
+	deadlines.clear();
+	deadlines.reserve(tasks.size());
+	for (const Task &task : tasks) {
+		TaskState &state = *task.state;
+		if (!state.scheduled) {
+			state.nextDeadline = now;
+			state.scheduled = true;
+		}
+		deadlines.push_back(Deadline{state.nextDeadline, &state});
+	}
+	std::make_heap(deadlines.begin(), deadlines.end(), std::greater<Deadline>());
+}
@@ -0,0 +1,190 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sharded_persistent_worker.cpp                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:51:45 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:51:45 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/threading/sharded_persistent_worker.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+constexpr double ShardedPersistentWorker::RebalanceTolerance;
+
+ShardedPersistentWorker::ShardedPersistentWorker(size_t shardCount)
+{
+	if (shardCount == 0)
+		shardCount = 1;
+	_shards.reserve(shardCount);
+	for (size_t i = 0; i < shardCount; ++i)
+		_shards.push_back(std::make_unique<PersistentWorker>());
+}
+
+void ShardedPersistentWorker::addTask(const std::string &name, const std::function<void()> &task)
+{
+	addTask(name, PersistentWorker::DefaultPeriod, task);
+}
+
+void ShardedPersistentWorker::addTask(const std::string &name, duration period, const std::function<void()> &task)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	place(name, period, task, std::hash<std::string>()(name) % _shards.size(), false);
+}
+
+/*
+** Explicitly placed tasks are pinned: rebalance() never moves them.
+*/
+void ShardedPersistentWorker::addTask(const std::string &name, duration period, const std::function<void()> &task, size_t shard)
+{
+	if (shard >= _shards.size())
+		throw std::runtime_error("Shard index out of range");
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	place(name, period, task, shard, true);
+}
+
+void ShardedPersistentWorker::removeTask(const std::string &name)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = _tasks.find(name);
+
+	if (it == _tasks.end())
+		return;
+	_shards[it->second.shard]->removeTask(name);
+	_tasks.erase(it);
+}
+
+bool ShardedPersistentWorker::hasTask(const std::string &name) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _tasks.count(name) != 0;
+}
+
+size_t ShardedPersistentWorker::taskCount() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _tasks.size();
+}
+
+size_t ShardedPersistentWorker::shardCount() const noexcept
+{
+	return _shards.size();
+}
+
+size_t ShardedPersistentWorker::shardOf(const std::string &name) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = _tasks.find(name);
+
+	if (it == _tasks.end())
+		throw std::runtime_error("Unknown task: " + name);
+	return it->second.shard;
+}
+
+ShardedPersistentWorker::TaskStats ShardedPersistentWorker::getStats(const std::string &name) const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	auto it = _tasks.find(name);
+
+	if (it == _tasks.end())
+		throw std::runtime_error("Unknown task: " + name);
+	return _shards[it->second.shard]->getStats(name);
+}
+
+/*
+** Longest-processing-time-first: pinned tasks are charged to their shard,
+** then unpinned tasks, heaviest first, go to the least loaded shard. A
+** task stays where it is while its shard remains within RebalanceTolerance
+** of the fair share, so measurement noise does not shuffle tasks between
+** calls. Returns the number of tasks moved.
+*/
+size_t ShardedPersistentWorker::rebalance()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	std::vector<double> shardLoad(_shards.size(), 0.0);
+	std::vector<std::pair<double, std::string>> movable;
+	double total = 0.0;
+
+	for (auto &task : _tasks) {
+		double load = measureLoad(task.first, task.second);
+		total += load;
+		if (task.second.pinned)
+			shardLoad[task.second.shard] += load;
+		else
+			movable.emplace_back(load, task.first);
+	}
+	std::sort(movable.begin(), movable.end(), [](const auto &a, const auto &b) {
+		return a.first != b.first ? a.first > b.first : a.second < b.second;
+	});
+
+	double fairShare = total / _shards.size() * (1.0 + RebalanceTolerance);
+	size_t moved = 0;
+	for (const auto &candidate : movable) {
+		Entry &entry = _tasks[candidate.second];
+		size_t target = entry.shard;
+
+		if (shardLoad[target] + candidate.first > fairShare) {
+			size_t lightest = std::min_element(shardLoad.begin(), shardLoad.end()) - shardLoad.begin();
+			if (shardLoad[lightest] < shardLoad[target])
+				target = lightest;
+		}
+		shardLoad[target] += candidate.first;
+		if (target == entry.shard)
+			continue;
+		_shards[entry.shard]->removeTask(candidate.second);
+		_shards[target]->addTask(candidate.second, entry.period, entry.function);
+		entry.shard = target;
+		++moved;
+	}
+	return moved;
+}
+
+/* Private Methods */
+
+/*
+** The busy flag travels with the task across shards: the copy left
+** running on the old shard holds it until it returns, and the new shard
+** skips its run in the meantime.
+*/
+void ShardedPersistentWorker::place(const std::string &name, duration period, const std::function<void()> &task, size_t shard, bool pinned)
+{
+	if (period <= duration::zero())
+		throw std::runtime_error("Task period must be positive");
+	if (_tasks.count(name))
+		return;
+
+	auto busy = std::make_shared<std::atomic<bool>>(false);
+	std::function<void()> guarded = [busy, task]() {
+		if (busy->exchange(true, std::memory_order_acquire))
+			return;
+		try {
+			task();
+		} catch (...) {
+			busy->store(false, std::memory_order_release);
+			throw;
+		}
+		busy->store(false, std::memory_order_release);
+	};
+
+	_shards[shard]->addTask(name, period, guarded);
+	_tasks.emplace(name, Entry{period, std::move(guarded), shard, pinned, 0.0});
+}
+
+/*
+** Fraction of a shard's time the task consumes. A task that has not run
+** yet on its current shard (freshly moved) keeps its last measurement.
+*/
+double ShardedPersistentWorker::measureLoad(const std::string &name, Entry &entry) const
+{
+	TaskStats stats = _shards[entry.shard]->getStats(name);
+
+	if (stats.runs > 0)
+		entry.load = std::chrono::duration<double>(stats.meanDuration).count() / std::chrono::duration<double>(stats.period).count();
+	return entry.load;
+}
@@ -0,0 +1,271 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task.tpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:37:37 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 02:35:46 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef TASK_TPP
+# define TASK_TPP
+
+/*#############################################################################
+# TaskDetail implementation
+#############################################################################*/
+
+inline bool TaskDetail::FinalAwaiter::await_ready() const noexcept
+{
+	return false;
+}
+
+template <typename TPromise>
+std::coroutine_handle<> TaskDetail::FinalAwaiter::await_suspend(std::coroutine_handle<TPromise> handle) noexcept
+{
+	std::coroutine_handle<> continuation = handle.promise().continuation;
+
+	return continuation ? continuation : std::noop_coroutine();
+}
+
+inline void TaskDetail::FinalAwaiter::await_resume() const noexcept
+{
+}
+
+inline std::suspend_always TaskDetail::PromiseBase::initial_suspend() const noexcept
+{
+	return {};
+}
+
+inline TaskDetail::FinalAwaiter TaskDetail::PromiseBase::final_suspend() const noexcept
+{
+	return {};
+}
+
+inline void TaskDetail::PromiseBase::unhandled_exception() noexcept
+{
+	_exception = std::current_exception();
+}
+
+template <typename TType>
+Task<TType> TaskDetail::Promise<TType>::get_return_object() noexcept
+{
+	return Task<TType>(std::coroutine_handle<Promise>::from_promise(*this));
+}
+
+template <typename TType>
+template <typename TValue>
+void TaskDetail::Promise<TType>::return_value(TValue &&value)
+{
+	_value.emplace(std::forward<TValue>(value));
+}
+
+template <typename TType>
+TType TaskDetail::Promise<TType>::result()
+{
+	if (_exception)
+		std::rethrow_exception(_exception);
+	return std::move(*_value);
+}
+
+inline Task<void> TaskDetail::Promise<void>::get_return_object() noexcept
+{
+	return Task<void>(std::coroutine_handle<Promise>::from_promise(*this));
+}
+
+inline void TaskDetail::Promise<void>::return_void() noexcept
+{
+}
+
+inline void TaskDetail::Promise<void>::result()
+{
+	if (_exception)
+		std::rethrow_exception(_exception);
+}
+
+inline TaskDetail::Detached TaskDetail::Detached::promise_type::get_return_object() const noexcept
+{
+	return {};
+}
+
+inline std::suspend_never TaskDetail::Detached::promise_type::initial_suspend() const noexcept
+{
+	return {};
+}
+
+inline std::suspend_never TaskDetail::Detached::promise_type::final_suspend() const noexcept
+{
+	return {};
+}
+
+inline void TaskDetail::Detached::promise_type::return_void() const noexcept
+{
+}
+
+inline void TaskDetail::Detached::promise_type::unhandled_exception() const noexcept
+{
+	std::terminate();
+}
+
+template <typename TType>
+TaskDetail::FutureAwaiter<TType>::FutureAwaiter(Future<TType> &&future) noexcept : _future(std::move(future))
+{
+}
+
+template <typename TType>
+bool TaskDetail::FutureAwaiter<TType>::await_ready() const
+{
+	return _future.isReady();
+}
+
+/*
+** The callback may resume the coroutine (and destroy this awaiter) before
+** onReady returns, so everything needed is copied to the stack first. The
+** future is ready by then, so a resume job dropped by the pool just
+** resumes inline and await_resume still returns the result.
+*/
+template <typename TType>
+void TaskDetail::FutureAwaiter<TType>::await_suspend(std::coroutine_handle<> handle)
+{
+	auto state = FutureDetail::Access::state(_future);
+	WorkerPool *pool = FutureDetail::Access::pool(_future);
+
+	state->onReady([handle, pool]() {
+		if (!pool) {
+			handle.resume();
+			return;
+		}
+		WorkerPool::ResumeJob job(handle, nullptr);
+		try {
+			pool->addJob(std::move(job));
+		} catch (...) {
+		}
+	});
+}
+
+template <typename TType>
+TType TaskDetail::FutureAwaiter<TType>::await_resume()
+{
+	return _future.get();
+}
+
+namespace TaskDetail {
+
+	/*
+	** A pool that shuts down before the task finishes makes the pending
+	** await throw, which lands in the promise like any other error.
+	*/
+	template <typename TType>
+	Detached runDetached(WorkerPool &pool, Task<TType> task, ::Promise<TType> promise)
+	{
+		try {
+			co_await pool.schedule();
+			if constexpr (std::is_void<TType>::value) {
+				co_await task;
+				promise.setValue();
+			} else {
+				promise.setValue(co_await task);
+			}
+		} catch (...) {
+			promise.setException(std::current_exception());
+		}
+	}
+}
+
+/*#############################################################################
+# Task class implementation
+#############################################################################*/
+
+/* Public Methods */
+
+template <typename TType>
+Task<TType>::Task() noexcept : _handle(nullptr)
+{
+}
+
+template <typename TType>
+Task<TType>::Task(Task &&other) noexcept : _handle(std::exchange(other._handle, nullptr))
+{
+}
+
+template <typename TType>
+Task<TType> &Task<TType>::operator=(Task &&other) noexcept
+{
+	if (this != &other) {
+		if (_handle)
+			_handle.destroy();
+		_handle = std::exchange(other._handle, nullptr);
+	}
+	return *this;
+}
+
+template <typename TType>
+Task<TType>::~Task() noexcept
+{
+	if (_handle)
+		_handle.destroy();
+}
+
+template <typename TType>
+bool Task<TType>::valid() const noexcept
+{
+	return static_cast<bool>(_handle);
+}
+
+template <typename TType>
+bool Task<TType>::await_ready() const noexcept
+{
+	return !_handle || _handle.done();
+}
+
+template <typename TType>
+std::coroutine_handle<> Task<TType>::await_suspend(std::coroutine_handle<> awaiting) noexcept
+{
+	_handle.promise().continuation = awaiting;
+	return _handle;
+}
+
+template <typename TType>
+TType Task<TType>::await_resume()
+{
+	if (!_handle)
+		throw std::runtime_error("Awaiting an empty Task");
+	return _handle.promise().result();
+}
+
+/* Private Methods */
+
+template <typename TType>
+Task<TType>::Task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle)
+{
+}
+
+/*#############################################################################
+# Free functions
+#############################################################################*/
+
+template <typename TType>
+Future<TType> spawn(WorkerPool &pool, Task<TType> task)
+{
+	Promise<TType> promise;
+	Future<TType> future = promise.getFuture(&pool);
+
+	TaskDetail::runDetached(pool, std::move(task), std::move(promise));
+	return future;
+}
+
+template <typename TType>
+TaskDetail::FutureAwaiter<TType> operator co_await(Future<TType> &&future) noexcept
+{
+	return TaskDetail::FutureAwaiter<TType>(std::move(future));
+}
+
+template <typename TType>
+TaskDetail::FutureAwaiter<TType> operator co_await(Future<TType> &future) noexcept
+{
+	return TaskDetail::FutureAwaiter<TType>(std::move(future));
+}
+
+#endif
@@ -0,0 +1,276 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   task_graph.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:08:09 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 02:26:58 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/threading/task_graph.hpp"
+
+/* Public Methods */
+
+TaskGraph::TaskGraph() : _validated(false), _pool(nullptr), _remainingNodes(0), _failed(false), _running(false)
+{
+}
+
+TaskGraph::~TaskGraph()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	_condition.wait(lock, [this]() { return !_running; });
+}
+
+TaskGraph::NodeId TaskGraph::addNode(const std::string &name, const std::function<void()> &task)
+{
+	checkIdle();
+
+	std::unique_ptr<Node> node(new Node());
+	node->name = name;
+	node->task = task;
+	node->predecessorCount = 0;
+	node->remaining.store(0);
+	_nodes.push_back(std::move(node));
+	_validated = false;
+	return _nodes.size() - 1;
+}
+
+void TaskGraph::addDependency(NodeId node, NodeId predecessor)
+{
+	checkIdle();
+	checkNode(node);
+	checkNode(predecessor);
+	if (node == predecessor)
+		throw std::runtime_error("TaskGraph node cannot depend on itself");
+
+	std::vector<NodeId> &successors = _nodes[predecessor]->successors;
+	if (std::find(successors.begin(), successors.end(), node) != successors.end())
+		return;
+	successors.push_back(node);
+	_nodes[node]->predecessorCount++;
+	_validated = false;
+}
+
+void TaskGraph::clear()
+{
+	checkIdle();
+	_nodes.clear();
+	_roots.clear();
+	_validated = false;
+}
+
+void TaskGraph::run(WorkerPool &pool)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_running)
+			throw std::runtime_error("TaskGraph is already running");
+		if (!_validated)
+			validate();
+		if (_nodes.empty())
+			return;
+
+		_running = true;
+		_pool = &pool;
+		_error = nullptr;
+		_failed.store(false);
+		_remainingNodes.store(_nodes.size());
+		for (auto &node : _nodes)
+			node->remaining.store(node->predecessorCount, std::memory_order_relaxed);
+	}
+
+	for (NodeId root : _roots)
+		schedule(root);
+}
+
+void TaskGraph::wait()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	if (_pool && _pool->isWorkerThread()) {
+		// Run other jobs from a worker instead of holding a pool thread
+		while (_running) {
+			lock.unlock();
+			if (!_pool->runPendingJob())
+				std::this_thread::yield();
+			lock.lock();
+		}
+	} else {
+		_condition.wait(lock, [this]() { return !_running; });
+	}
+
+	if (_error) {
+		std::exception_ptr error = _error;
+		_error = nullptr;
+		std::rethrow_exception(error);
+	}
+}
+
+void TaskGraph::runAndWait(WorkerPool &pool)
+{
+	run(pool);
+	wait();
+}
+
+bool TaskGraph::isRunning() const noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return _running;
+}
+
+size_t TaskGraph::size() const noexcept
+{
+	return _nodes.size();
+}
+
+const std::string &TaskGraph::getName(NodeId node) const
+{
+	checkNode(node);
+	return _nodes[node]->name;
+}
+
+/* Private Methods */
+
+void TaskGraph::validate()
+{
+	// Kahn's algorithm: every node must be reachable through zero in-degree
+	std::vector<size_t> inDegree(_nodes.size());
+	std::vector<NodeId> ready;
+
+	_roots.clear();
+	for (NodeId id = 0; id < _nodes.size(); id++) {
+		inDegree[id] = _nodes[id]->predecessorCount;
+		if (inDegree[id] == 0) {
+			_roots.push_back(id);
+			ready.push_back(id);
+		}
+	}
+
+	size_t visited = 0;
+	while (!ready.empty()) {
+		NodeId id = ready.back();
+		ready.pop_back();
+		visited++;
+		for (NodeId successor : _nodes[id]->successors) {
+			if (--inDegree[successor] == 0)
+				ready.push_back(successor);
+		}
+	}
+
+	if (visited != _nodes.size())
+		throw std::runtime_error("TaskGraph contains a cycle");
+	_validated = true;
+}
+
+void TaskGraph::checkNode(NodeId node) const
+{
+	if (node >= _nodes.size())
+		throw std::out_of_range("TaskGraph node id out of range");
+}
+
+void TaskGraph::checkIdle() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_running)
+		throw std::runtime_error("TaskGraph cannot be modified while running");
+}
+
+/*
+** A NodeJob that addJob fails to queue is destroyed during unwinding,
+** which abandons its node, so the run is already accounted for and may
+** even have finished: the graph must not be touched after the catch.
+*/
+void TaskGraph::schedule(NodeId node) noexcept
+{
+	try {
+		_pool->addJob(NodeJob(this, node));
+	} catch (...) {
+	}
+}
+
+void TaskGraph::execute(NodeId id)
+{
+	while (true) {
+		Node &node = *_nodes[id];
+
+		if (!_failed.load(std::memory_order_relaxed)) {
+			try {
+				if (node.task)
+					node.task();
+			} catch (...) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (!_failed.exchange(true))
+					_error = std::current_exception();
+			}
+		}
+
+		// Keep one ready successor on this thread, hand the others to the pool
+		bool hasNext = false;
+		NodeId next = 0;
+		for (NodeId successor : node.successors) {
+			if (_nodes[successor]->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				continue;
+			if (hasNext)
+				schedule(next);
+			next = successor;
+			hasNext = true;
+		}
+
+		if (_remainingNodes.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			finishRun();
+			return;
+		}
+		if (!hasNext)
+			return;
+		id = next;
+	}
+}
+
+/*
+** Runs the node as skipped so its successors are still counted down and
+** the run finishes instead of leaving wait() blocked.
+*/
+void TaskGraph::abandon(NodeId id) noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_failed.exchange(true))
+			_error = std::make_exception_ptr(std::future_error(std::future_errc::broken_promise));
+	}
+	try {
+		execute(id);
+	} catch (...) {
+	}
+}
+
+void TaskGraph::finishRun()
+{
+	// Notify under the lock: the graph may be destroyed as soon as wait() returns
+	std::lock_guard<std::mutex> lock(_mutex);
+	_running = false;
+	_condition.notify_all();
+}
+
+/* Node job */
+
+TaskGraph::NodeJob::NodeJob(TaskGraph *graph, NodeId node) noexcept : _graph(graph), _node(node)
+{
+}
+
+TaskGraph::NodeJob::NodeJob(NodeJob &&other) noexcept : _graph(std::exchange(other._graph, nullptr)), _node(other._node)
+{
+}
+
+TaskGraph::NodeJob::~NodeJob() noexcept
+{
+	if (_graph)
+		_graph->abandon(_node);
+}
+
+void TaskGraph::NodeJob::operator()()
+{
+	std::exchange(_graph, nullptr)->execute(_node);
+}
@@ -6,19 +6,27 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/11 12:23:08 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 15:21:56 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 22:24:39 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../inc/threading/thread.hpp"
 
+#include <future>
+
 /* Public Methods */
 
-Thread::Thread(const std::string &name, std::function<void()> function) : _name(name),  _running(false), _function(function)
+Thread::Thread(const std::string &name, std::function<void()> function) : Thread(name, function, ThreadAttributes())
+{
+}
+
+Thread::Thread(const std::string &name, std::function<void()> function, const ThreadAttributes &attributes) : _name(name),  _running(false), _function(function), _attributes(attributes)
 {
+	if (_attributes.name.empty())
+		_attributes.name = _name;
 }
 
-Thread::Thread(Thread &&other) noexcept : _name(std::move(other._name)), _thread(std::move(other._thread)), _running(other._running.load()), _function(std::move(other._function))
+Thread::Thread(Thread &&other) noexcept : _name(std::move(other._name)), _thread(std::move(other._thread)), _running(other._running.load()), _function(std::move(other._function)), _attributes(std::move(other._attributes))
 {
 	other._running.store(false);
 }
@@ -28,6 +36,7 @@ Thread& Thread::operator=(Thread &&other) noexcept
 	if (this != &other) {
 		_name = std::move(other._name);
 		_function = std::move(other._function);
+		_attributes = std::move(other._attributes);
 		_thread = std::move(other._thread);
 		_running.store(other._running.load());
 		other._running.store(false);
@@ -40,11 +49,37 @@ Thread::~Thread() noexcept
 	stop();
 }
 
+/*
+** The new thread applies its attributes before running the function and
+** reports the outcome, so a failed placement throws here instead of
+** silently leaving the thread unpinned.
+*/
 void Thread::start()
 {
-	if (!_running.load()) {
-		_running.store(true);
-		_thread = std::thread(&Thread::entryPointThread, this);
+	if (_running.load())
+		return;
+
+	std::promise<void> placed;
+	std::future<void> result = placed.get_future();
+
+	_running.store(true);
+	_thread = std::thread([this, placed = std::move(placed)]() mutable {
+		try {
+			_attributes.applyToCurrentThread();
+		} catch (...) {
+			placed.set_exception(std::current_exception());
+			return;
+		}
+		placed.set_value();
+		entryPointThread(this);
+	});
+
+	try {
+		result.get();
+	} catch (...) {
+		_thread.join();
+		_running.store(false);
+		throw;
 	}
 }
 
@@ -67,6 +102,11 @@ const std::string& Thread::getName() const
 	return _name;
 }
 
+const ThreadAttributes &Thread::getAttributes() const
+{
+	return _attributes;
+}
+
 std::thread::id Thread::getThreadId() const
 {
 	return _thread.get_id();
@@ -0,0 +1,186 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_attributes.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:20:43 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:20:43 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/threading/thread_attributes.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#if defined(__linux__)
+# include <sys/syscall.h>
+#endif
+
+namespace
+{
+	const size_t OS_NAME_MAX = 15;
+
+	void throwError(const std::string &what, int error)
+	{
+		throw std::runtime_error(what + ": " + std::strerror(error));
+	}
+
+	void applyName(const std::string &name)
+	{
+		std::string truncated = name.substr(0, OS_NAME_MAX);
+		int error;
+
+#if defined(__APPLE__)
+		error = pthread_setname_np(truncated.c_str());
+#else
+		error = pthread_setname_np(pthread_self(), truncated.c_str());
+#endif
+		if (error)
+			throwError("Failed to set thread name", error);
+	}
+
+	void applyAffinity(const std::vector<int> &cpus)
+	{
+#if defined(__linux__)
+		cpu_set_t set;
+
+		CPU_ZERO(&set);
+		for (int cpu : cpus) {
+			if (cpu < 0 || cpu >= CPU_SETSIZE)
+				throw std::runtime_error("Invalid CPU index: " + std::to_string(cpu));
+			CPU_SET(cpu, &set);
+		}
+		if (int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set))
+			throwError("Failed to set CPU affinity", error);
+#else
+		(void)cpus;
+		throw std::runtime_error("CPU affinity is not supported on this platform");
+#endif
+	}
+
+	void applyPolicy(ThreadAttributes::SchedulingPolicy policy, int priority)
+	{
+		struct sched_param param;
+		int native;
+
+		std::memset(&param, 0, sizeof(param));
+		switch (policy) {
+			case ThreadAttributes::SchedulingPolicy::FIFO:
+				native = SCHED_FIFO;
+				param.sched_priority = priority;
+				break;
+			case ThreadAttributes::SchedulingPolicy::ROUND_ROBIN:
+				native = SCHED_RR;
+				param.sched_priority = priority;
+				break;
+#if defined(__linux__)
+			case ThreadAttributes::SchedulingPolicy::BATCH:
+				native = SCHED_BATCH;
+				break;
+			case ThreadAttributes::SchedulingPolicy::IDLE:
+				native = SCHED_IDLE;
+				break;
+#else
+			case ThreadAttributes::SchedulingPolicy::BATCH:
+			case ThreadAttributes::SchedulingPolicy::IDLE:
+				throw std::runtime_error("Scheduling policy is not supported on this platform");
+#endif
+			default:
+				native = SCHED_OTHER;
+				break;
+		}
+		if (int error = pthread_setschedparam(pthread_self(), native, &param))
+			throwError("Failed to set scheduling policy", error);
+	}
+
+	void applyNice(int nice)
+	{
+#if defined(__linux__)
+		// On Linux the nice value is per thread, addressed by its kernel tid
+		id_t tid = static_cast<id_t>(syscall(SYS_gettid));
+
+		if (setpriority(PRIO_PROCESS, tid, nice) != 0)
+			throwError("Failed to set nice value", errno);
+#else
+		(void)nice;
+		throw std::runtime_error("Per-thread nice values are not supported on this platform");
+#endif
+	}
+}
+
+/* Public Methods */
+
+void ThreadAttributes::applyToCurrentThread() const
+{
+	if (!name.empty())
+		applyName(name);
+	if (!cpus.empty())
+		applyAffinity(cpus);
+	if (policy != SchedulingPolicy::INHERIT)
+		applyPolicy(policy, priority);
+	if (adjustNice)
+		applyNice(nice);
+}
+
+/*
+** CPUs the process may run on, falling back to 0..hardware_concurrency-1
+** where the affinity mask cannot be queried.
+*/
+std::vector<int> ThreadAttributes::availableCpus()
+{
+	std::vector<int> cpus;
+
+#if defined(__linux__)
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+		for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &set))
+				cpus.push_back(cpu);
+		}
+	}
+#endif
+	if (cpus.empty()) {
+		unsigned count = std::max(1u, std::thread::hardware_concurrency());
+		for (unsigned cpu = 0; cpu < count; cpu++)
+			cpus.push_back(static_cast<int>(cpu));
+	}
+	return cpus;
+}
+
+std::vector<int> ThreadAttributes::currentAffinity()
+{
+	std::vector<int> cpus;
+
+#if defined(__linux__)
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+		for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &set))
+				cpus.push_back(cpu);
+		}
+	}
+#endif
+	return cpus;
+}
+
+std::string ThreadAttributes::currentName()
+{
+	char buffer[OS_NAME_MAX + 1] = {0};
+
+	if (pthread_getname_np(pthread_self(), buffer, sizeof(buffer)) != 0)
+		return std::string();
+	return std::string(buffer);
+}
@@ -6,27 +6,49 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/10 23:46:18 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 14:12:03 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 00:32:51 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../inc/threading/thread_safe_iostream.hpp"
+#include "../../inc/threading/async_line_writer.hpp"
+#include "../../inc/time/timestamp_formatter.hpp"
+
+#include <cstring>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
 
 std::mutex ThreadSafeIOStream::_global_mutex;
 thread_local std::string ThreadSafeIOStream::_buffer;
+thread_local std::string ThreadSafeIOStream::_output;
+std::atomic<bool> ThreadSafeIOStream::_async(false);
+ThreadSafeIOStream::FlushPolicy ThreadSafeIOStream::_flush_policy;
+std::string ThreadSafeIOStream::_pending;
+std::chrono::steady_clock::time_point ThreadSafeIOStream::_pending_since;
+std::thread ThreadSafeIOStream::_flusher;
+std::condition_variable ThreadSafeIOStream::_flusher_condition;
+bool ThreadSafeIOStream::_flusher_stop = false;
+// Defined last so it runs before the members above are destroyed
+ThreadSafeIOStream::ExitFlush ThreadSafeIOStream::_exit_flush;
+constexpr size_t ThreadSafeIOStream::ExitFlushLimit;
 thread_local ThreadSafeIOStream threadSafeCout;
 
 /* Public Methods */
 
-ThreadSafeIOStream::ThreadSafeIOStream() :  _line_start(true), _prefix("")
+ThreadSafeIOStream::ThreadSafeIOStream() :  _line_start(true), _prefix(""), _timestamped(false)
 {
 }
 
 ThreadSafeIOStream::~ThreadSafeIOStream() 
 {
+	if (!_async.load(std::memory_order_acquire)) {
+		std::lock_guard<std::mutex> lock(_global_mutex);
+		write_pending();
+	}
 }
 
-ThreadSafeIOStream::ThreadSafeIOStream(const ThreadSafeIOStream &other) : _line_start(other._line_start), _prefix(other._prefix)
+ThreadSafeIOStream::ThreadSafeIOStream(const ThreadSafeIOStream &other) : _line_start(other._line_start), _prefix(other._prefix), _timestamped(other._timestamped)
 {
 }
 
@@ -34,12 +56,14 @@ ThreadSafeIOStream &ThreadSafeIOStream::operator=(const ThreadSafeIOStream &othe
 {
 	if (this != &other) {
 		_prefix = other._prefix;
+		_timestamped = other._timestamped;
 		_line_start = other._line_start;
 	}
 	return *this;
 }
 
-ThreadSafeIOStream::ThreadSafeIOStream(ThreadSafeIOStream &&other) noexcept : _line_start(other._line_start), _prefix(std::move(other._prefix))
+ThreadSafeIOStream::ThreadSafeIOStream(ThreadSafeIOStream &&other) noexcept : _line_start(other._line_start), _prefix(std::move(other._prefix)),
+	_timestamped(other._timestamped)
 {
 	other._line_start = true;
 }
@@ -48,6 +72,7 @@ ThreadSafeIOStream &ThreadSafeIOStream::operator=(ThreadSafeIOStream &&other) no
 {
 	if (this != &other) {
 		_prefix = std::move(other._prefix);
+		_timestamped = other._timestamped;
 		_line_start = other._line_start;
 		other._line_start = true;
 	}
@@ -64,56 +89,290 @@ const std::string &ThreadSafeIOStream::getPrefix() const
 	return _prefix;
 }
 
+void ThreadSafeIOStream::setTimestamped(bool timestamped)
+{
+	_timestamped = timestamped;
+}
+
+bool ThreadSafeIOStream::isTimestamped() const
+{
+	return _timestamped;
+}
+
 ThreadSafeIOStream &ThreadSafeIOStream::operator<<(std::ostream &(*manip)(std::ostream &)) 
 {
+	// Prefixes are inserted before taking the lock; only the write is serialized
+	const std::string *text = &_buffer;
+	if ((!_prefix.empty() || _timestamped) && !_buffer.empty()) {
+		_output.clear();
+		format_with_prefix(_buffer, _output);
+		text = &_output;
+	}
+
+	if (_async.load(std::memory_order_acquire)) {
+		if (text == &_buffer) {
+			_output.swap(_buffer);
+			text = &_output;
+		}
+		append_manipulator(_output, manip);
+		if (!_output.empty())
+			async_writer().submit(_output.data(), _output.size());
+		_output.clear();
+		_buffer.clear();
+		_line_start = true;
+		return *this;
+	}
+
 	std::lock_guard<std::mutex> lock(_global_mutex);
 	
-	std::string full_content = _buffer;
-	_buffer.clear();
-	
-	if (!full_content.empty()) {
-		std::string formatted = format_with_prefix(full_content);
-		std::cout << formatted;
+	if (_flush_policy.mode == FlushMode::LINE) {
+		if (!text->empty())
+			std::cout.write(text->data(), text->size());
+		std::cout << manip;
+		std::cout.flush();
+	} else {
+		auto now = std::chrono::steady_clock::now();
+		if (_pending.empty()) {
+			_pending_since = now;
+			_flusher_condition.notify_one();
+		}
+		_pending.append(*text);
+		append_manipulator(_pending, manip);
+		if (flush_due(now) || manip == static_cast<std::ostream &(*)(std::ostream &)>(std::flush<char, std::char_traits<char>>))
+			write_pending();
+		else if (_flush_policy.mode == FlushMode::INTERVAL && !_flusher.joinable() && !_flusher_stop)
+			_flusher = std::thread(&ThreadSafeIOStream::flusher_routine);
 	}
-	
-	std::cout << manip;
-	std::cout.flush();
+	_buffer.clear();
 	
 	_line_start = true;
 	
 	return *this;
 }
 
+/*
+** Whatever std::cout already holds is flushed before the writer takes over
+** the descriptor, and the writer is drained before std::cout takes it back.
+*/
+void ThreadSafeIOStream::setOutputMode(OutputMode mode)
+{
+	std::lock_guard<std::mutex> lock(_global_mutex);
+
+	if (mode == OutputMode::ASYNC) {
+		write_pending();
+		std::cout.flush();
+		async_writer().start();
+		_async.store(true, std::memory_order_release);
+	} else {
+		_async.store(false, std::memory_order_release);
+		async_writer().stop();
+		async_writer().flush();
+	}
+}
+
+ThreadSafeIOStream::OutputMode ThreadSafeIOStream::getOutputMode() noexcept
+{
+	return _async.load(std::memory_order_acquire) ? OutputMode::ASYNC : OutputMode::SYNC;
+}
+
+void ThreadSafeIOStream::flush()
+{
+	if (_async.load(std::memory_order_acquire)) {
+		async_writer().flush();
+		return;
+	}
+	std::lock_guard<std::mutex> lock(_global_mutex);
+	write_pending();
+	std::cout.flush();
+}
+
+/*
+** Pending output is written under the old policy before the new one
+** applies.
+*/
+void ThreadSafeIOStream::setFlushPolicy(const FlushPolicy &policy)
+{
+	if (policy.interval <= std::chrono::milliseconds::zero())
+		throw std::runtime_error("Flush interval must be positive");
+	if (policy.size == 0)
+		throw std::runtime_error("Flush size must be positive");
+
+	std::unique_lock<std::mutex> lock(_global_mutex);
+	write_pending();
+	_flush_policy = policy;
+	if (policy.mode == FlushMode::INTERVAL)
+		_flusher_condition.notify_all();
+	else
+		stop_flusher(lock);
+}
+
+ThreadSafeIOStream::FlushPolicy ThreadSafeIOStream::getFlushPolicy()
+{
+	std::lock_guard<std::mutex> lock(_global_mutex);
+	return _flush_policy;
+}
+
+/*
+** A terminal wants every line as it comes; a pipe reader wants lines
+** promptly but not one syscall each; files and devices take big writes.
+** Only applied through setFlushPolicy(stdoutFlushPolicy()).
+*/
+ThreadSafeIOStream::FlushPolicy ThreadSafeIOStream::stdoutFlushPolicy()
+{
+	FlushPolicy policy;
+	struct stat info;
+
+	if (isatty(STDOUT_FILENO) || fstat(STDOUT_FILENO, &info) != 0)
+		policy.mode = FlushMode::LINE;
+	else if (S_ISFIFO(info.st_mode) || S_ISSOCK(info.st_mode))
+		policy.mode = FlushMode::INTERVAL;
+	else
+		policy.mode = FlushMode::SIZE;
+	return policy;
+}
+
 /* Private Methods */
 
+ThreadSafeIOStream::ExitFlush::~ExitFlush()
+{
+	std::unique_lock<std::mutex> lock(_global_mutex);
+	stop_flusher(lock);
+	write_pending();
+}
+
 void ThreadSafeIOStream::print_prefix_if_needed() 
 {
-	if (_line_start && !_prefix.empty()) {
+	if (_line_start && (!_prefix.empty() || _timestamped)) {
+		if (_timestamped) {
+			char stamp[TimestampFormatter::MaxLength];
+			std::cout.write(stamp, TimestampFormatter::perThread().format(std::chrono::system_clock::now(), stamp)) << ' ';
+		}
 		std::cout << _prefix;
 		_line_start = false;
 	}
 }
 
-std::string ThreadSafeIOStream::format_with_prefix(const std::string &text) 
+/*
+** Appends text to out with the timestamp and prefix at the start of every
+** line: before the first one if we are at a line start, then after each
+** newline that is followed by more text. The clock is read once per call.
+*/
+void ThreadSafeIOStream::format_with_prefix(std::string_view text, std::string &out) const
 {
-	if (_prefix.empty() || text.empty()) {
-		return text;
+	if (_prefix.empty() && !_timestamped) {
+		out.append(text.data(), text.size());
+		return;
 	}
 	
-	std::string result;
+	char stamp[TimestampFormatter::MaxLength + 1];
+	size_t stamp_length = 0;
+	if (_timestamped) {
+		stamp_length = TimestampFormatter::perThread().format(std::chrono::system_clock::now(), stamp);
+		stamp[stamp_length++] = ' ';
+	}
+
+	const char *cursor = text.data();
+	const char *end = cursor + text.size();
 	bool need_prefix = _line_start;
 	
-	for (char c : text) {
-		if (need_prefix) {
-			result += _prefix;
-			need_prefix = false;
-		}
+	while (cursor < end) {
+		if (need_prefix)
+			out.append(stamp, stamp_length).append(_prefix);
 		
-		result += c;
-		
-		if (c == '\n')
-			need_prefix = true;
+		const char *newline = static_cast<const char *>(std::memchr(cursor, '\n', end - cursor));
+		const char *stop = newline ? newline + 1 : end;
+		out.append(cursor, stop - cursor);
+		cursor = stop;
+		need_prefix = true;
+	}
+}
+
+/*
+** std::endl and std::flush are by far the common cases; anything else is
+** applied to a scratch stream.
+*/
+void ThreadSafeIOStream::append_manipulator(std::string &out, std::ostream &(*manip)(std::ostream &))
+{
+	using Manipulator = std::ostream &(*)(std::ostream &);
+
+	if (manip == static_cast<Manipulator>(std::endl<char, std::char_traits<char>>)) {
+		out += '\n';
+	} else if (manip != static_cast<Manipulator>(std::flush<char, std::char_traits<char>>)) {
+		std::ostringstream oss;
+		oss << manip;
+		out += oss.str();
+	}
+}
+
+// Created on first use and drained when the program exits
+AsyncLineWriter &ThreadSafeIOStream::async_writer()
+{
+	static AsyncLineWriter writer(STDOUT_FILENO);
+	return writer;
+}
+
+// Called with _global_mutex held
+bool ThreadSafeIOStream::flush_due(std::chrono::steady_clock::time_point now)
+{
+	if (_pending.size() >= ExitFlushLimit)
+		return true;
+	switch (_flush_policy.mode) {
+		case FlushMode::LINE:
+			return true;
+		case FlushMode::INTERVAL:
+			return now - _pending_since >= _flush_policy.interval;
+		case FlushMode::SIZE:
+			return _pending.size() >= _flush_policy.size;
+		case FlushMode::EXIT:
+			break;
+	}
+	return false;
+}
+
+// Called with _global_mutex held
+void ThreadSafeIOStream::write_pending()
+{
+	if (_pending.empty())
+		return;
+	std::cout.write(_pending.data(), _pending.size());
+	std::cout.flush();
+	_pending.clear();
+}
+
+/*
+** _flusher_stop stays set until the join completes so no line starts a
+** second flusher in the meantime.
+*/
+void ThreadSafeIOStream::stop_flusher(std::unique_lock<std::mutex> &lock)
+{
+	if (!_flusher.joinable())
+		return;
+	_flusher_stop = true;
+	_flusher_condition.notify_all();
+	std::thread flusher = std::move(_flusher);
+	lock.unlock();
+	flusher.join();
+	lock.lock();
+	_flusher_stop = false;
+}
+
+/*
+** Writes lines that have waited a full interval when no new line does it.
+** Sleeps indefinitely while nothing is pending.
+*/
+void ThreadSafeIOStream::flusher_routine()
+{
+	std::unique_lock<std::mutex> lock(_global_mutex);
+
+	while (!_flusher_stop) {
+		if (_pending.empty()) {
+			_flusher_condition.wait(lock);
+			continue;
+		}
+		auto due = _pending_since + _flush_policy.interval;
+		if (std::chrono::steady_clock::now() >= due)
+			write_pending();
+		else
+			_flusher_condition.wait_until(lock, due);
 	}
-	
-	return result;
 }
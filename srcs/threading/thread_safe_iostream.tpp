@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/11 00:01:34 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 14:09:54 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 23:04:32 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,11 +16,7 @@
 template<typename T>
 ThreadSafeIOStream &ThreadSafeIOStream::operator<<(const T &value)
 {
-	std::ostringstream oss;
-	oss << value;
-	std::string text = oss.str();
-	
-	_buffer += text;
+	append(_buffer, value);
 
 	return *this;
 }
@@ -28,6 +24,7 @@ ThreadSafeIOStream &ThreadSafeIOStream::operator<<(const T &value)
 template<typename T>
 ThreadSafeIOStream &ThreadSafeIOStream::operator>>(T &value) 
 {
+	flush();
 	std::lock_guard<std::mutex> lock(_global_mutex);
 	
 	print_prefix_if_needed();
@@ -40,14 +37,58 @@ ThreadSafeIOStream &ThreadSafeIOStream::operator>>(T &value)
 template<typename T>
 void ThreadSafeIOStream::prompt(const std::string &question, T &dest) 
 {
+	flush();
 	std::lock_guard<std::mutex> lock(_global_mutex);
 	
-	std::string formatted_question = format_with_prefix(question + " ");
-	std::cout << formatted_question;
+	_output.clear();
+	format_with_prefix(question + " ", _output);
+	std::cout.write(_output.data(), _output.size());
 	std::cout.flush();
 	
 	std::cin >> dest;
 	_line_start = true;
 }
 
+/*
+** Formats the way a default-state std::ostream would (bools as 1/0,
+** character types as characters, floating point as %g with precision 6)
+** but straight into the thread-local buffer. Types without a direct path
+** still go through an ostringstream.
+*/
+template<typename T>
+void ThreadSafeIOStream::append(std::string &out, const T &value)
+{
+	using Type = std::decay_t<T>;
+
+	if constexpr (std::is_same_v<Type, std::string>) {
+		out += value;
+	} else if constexpr (std::is_same_v<Type, std::string_view>) {
+		out.append(value.data(), value.size());
+	} else if constexpr (std::is_array_v<T> && std::is_same_v<std::remove_cv_t<std::remove_extent_t<T>>, char>) {
+		out += value;
+	} else if constexpr (std::is_same_v<Type, char *> || std::is_same_v<Type, const char *>) {
+		if (value)
+			out += value;
+	} else if constexpr (std::is_same_v<Type, bool>) {
+		out += value ? '1' : '0';
+	} else if constexpr (std::is_same_v<Type, char> || std::is_same_v<Type, signed char> || std::is_same_v<Type, unsigned char>) {
+		out += static_cast<char>(value);
+	} else if constexpr ((std::is_integral_v<Type> && !std::is_same_v<Type, wchar_t>
+						&& !std::is_same_v<Type, char16_t> && !std::is_same_v<Type, char32_t>)
+						|| std::is_floating_point_v<Type>) {
+		char digits[64];
+		std::to_chars_result result;
+
+		if constexpr (std::is_floating_point_v<Type>)
+			result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::general, 6);
+		else
+			result = std::to_chars(digits, digits + sizeof(digits), value);
+		out.append(digits, result.ptr - digits);
+	} else {
+		std::ostringstream oss;
+		oss << value;
+		out += oss.str();
+	}
+}
+
 #endif
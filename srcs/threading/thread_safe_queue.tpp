@@ -6,7 +6,7 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/08 00:57:16 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 15:02:14 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 21:57:32 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -84,6 +84,27 @@ TType ThreadSafeQueue<TType>::pop_front()
 	return fvalue;
 }
 
+template <typename TType>
+bool ThreadSafeQueue<TType>::try_pop_back(TType &value)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_queue.empty())
+		return false;
+	value = std::move(_queue.back());
+	_queue.pop_back();
+	return true;
+}
+
+template <typename TType>
+bool ThreadSafeQueue<TType>::try_pop_front(TType &value)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (_queue.empty())
+		return false;
+	value = std::move(_queue.front());
+	_queue.pop_front();
+	return true;
+}
 
 template <typename TType>
 bool ThreadSafeQueue<TType>::empty() const noexcept
@@ -0,0 +1,248 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timer_queue.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:31:22 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 01:11:20 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/threading/timer_queue.hpp"
+#include "../../inc/threading/worker_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+struct TimerHandle::State
+{
+	enum Status
+	{
+		PENDING,
+		FIRED,
+		CANCELLED
+	};
+
+	Job job;
+	TimerQueue::Clock::duration period;
+	std::shared_ptr<std::atomic<int64_t>> cancelled;
+	std::atomic<int> status{PENDING};
+	std::atomic<bool> running{false};
+};
+
+/* TimerHandle */
+
+TimerHandle::TimerHandle() noexcept
+{
+}
+
+TimerHandle::TimerHandle(std::shared_ptr<State> state) noexcept : _state(std::move(state))
+{
+}
+
+/*
+** Returns true when this call stopped a timer that would otherwise have
+** fired (again).
+*/
+bool TimerHandle::cancel() noexcept
+{
+	int expected = State::PENDING;
+
+	if (!_state || !_state->status.compare_exchange_strong(expected, State::CANCELLED))
+		return false;
+	// Shared with the queue, which may already be gone
+	_state->cancelled->fetch_add(1, std::memory_order_relaxed);
+	return true;
+}
+
+bool TimerHandle::isActive() const noexcept
+{
+	return _state && _state->status.load() == State::PENDING;
+}
+
+TimerHandle::operator bool() const noexcept
+{
+	return static_cast<bool>(_state);
+}
+
+/* Public Methods */
+
+TimerQueue::TimerQueue(WorkerPool &pool, const std::string &threadName)
+	: _pool(pool), _cancelled(std::make_shared<std::atomic<int64_t>>(0)), _sequence(0), _running(true)
+{
+	_thread = std::thread(&TimerQueue::run, this, threadName);
+}
+
+TimerQueue::~TimerQueue() noexcept
+{
+	stop();
+}
+
+TimerHandle TimerQueue::add(Clock::time_point due, Clock::duration period, Job &&job)
+{
+	auto state = std::make_shared<TimerHandle::State>();
+	bool earliest;
+
+	state->job = std::move(job);
+	state->period = period;
+	state->cancelled = _cancelled;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_running)
+			throw std::runtime_error("Timer queue is stopped");
+		compact();
+		_heap.push_back(Entry{due, _sequence++, state});
+		std::push_heap(_heap.begin(), _heap.end(), Later());
+		earliest = _heap.front().state == state;
+	}
+	if (earliest)
+		_condition.notify_one();
+	return TimerHandle(state);
+}
+
+/*
+** Pending timers are dropped and marked cancelled.
+*/
+void TimerQueue::stop() noexcept
+{
+	std::vector<Entry> dropped;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (!_running)
+			return;
+		_running = false;
+		dropped.swap(_heap);
+		_cancelled->store(0, std::memory_order_relaxed);
+	}
+	_condition.notify_one();
+	if (_thread.joinable())
+		_thread.join();
+	for (Entry &entry : dropped) {
+		int expected = TimerHandle::State::PENDING;
+		entry.state->status.compare_exchange_strong(expected, TimerHandle::State::CANCELLED);
+	}
+}
+
+size_t TimerQueue::pending() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	int64_t live = static_cast<int64_t>(_heap.size()) - _cancelled->load(std::memory_order_relaxed);
+
+	// A cancel() may count its entry just after the timer thread dropped it
+	return live > 0 ? static_cast<size_t>(live) : 0;
+}
+
+/* Private Methods */
+
+bool TimerQueue::Later::operator()(const Entry &left, const Entry &right) const noexcept
+{
+	if (left.due != right.due)
+		return left.due > right.due;
+	return left.sequence > right.sequence;
+}
+
+void TimerQueue::run(const std::string &threadName)
+{
+	ThreadAttributes attributes;
+	std::vector<std::shared_ptr<TimerHandle::State>> due;
+
+	attributes.name = threadName;
+	try {
+		attributes.applyToCurrentThread();
+	} catch (const std::exception &) {
+		// Naming the timer thread is cosmetic
+	}
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (_running) {
+		compact();
+		if (_heap.empty()) {
+			_condition.wait(lock);
+			continue;
+		}
+		// A copy: add() may reallocate the heap while we wait
+		Clock::time_point now = Clock::now();
+		Clock::time_point next = _heap.front().due;
+		if (next > now) {
+			_condition.wait_until(lock, next);
+			continue;
+		}
+
+		// Collect everything due, then hand it to the pool without the lock
+		while (!_heap.empty() && _heap.front().due <= now) {
+			std::pop_heap(_heap.begin(), _heap.end(), Later());
+			Entry entry = std::move(_heap.back());
+			_heap.pop_back();
+
+			if (entry.state->status.load() == TimerHandle::State::CANCELLED) {
+				_cancelled->fetch_sub(1, std::memory_order_relaxed);
+				continue;
+			}
+			if (entry.state->period > Clock::duration::zero()) {
+				entry.due += entry.state->period;
+				if (entry.due <= now)
+					entry.due = now + entry.state->period;
+				entry.sequence = _sequence++;
+				due.push_back(entry.state);
+				_heap.push_back(std::move(entry));
+				std::push_heap(_heap.begin(), _heap.end(), Later());
+			} else {
+				due.push_back(std::move(entry.state));
+			}
+		}
+
+		lock.unlock();
+		for (const auto &state : due)
+			dispatch(state);
+		due.clear();
+		lock.lock();
+	}
+}
+
+void TimerQueue::dispatch(const std::shared_ptr<TimerHandle::State> &state)
+{
+	if (state->period > Clock::duration::zero()) {
+		// Skip this tick while the previous run is still going
+		if (state->running.exchange(true))
+			return;
+		_pool.addJob([state]() {
+			struct Reset
+			{
+				std::atomic<bool> &flag;
+				~Reset() { flag.store(false); }
+			} reset{state->running};
+
+			if (state->status.load() == TimerHandle::State::PENDING)
+				state->job();
+		});
+		return;
+	}
+
+	// A one-shot cancelled after leaving the heap was counted as if still in it
+	int expected = TimerHandle::State::PENDING;
+	if (state->status.compare_exchange_strong(expected, TimerHandle::State::FIRED))
+		_pool.addJob([state]() { state->job(); });
+	else
+		_cancelled->fetch_sub(1, std::memory_order_relaxed);
+}
+
+/*
+** Called with the lock held. Drops every cancelled entry once they are
+** more than half of the heap, so cancelled far-off timers do not pin
+** their jobs until their deadline.
+*/
+void TimerQueue::compact()
+{
+	if (_cancelled->load(std::memory_order_relaxed) * 2 <= static_cast<int64_t>(_heap.size()))
+		return;
+
+	auto live = std::remove_if(_heap.begin(), _heap.end(), [](const Entry &entry) {
+		return entry.state->status.load() == TimerHandle::State::CANCELLED;
+	});
+	_cancelled->fetch_sub(_heap.end() - live, std::memory_order_relaxed);
+	_heap.erase(live, _heap.end());
+	std::make_heap(_heap.begin(), _heap.end(), Later());
+}
@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   work_stealing_deque.tpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:00:41 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:00:41 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WORK_STEALING_DEQUE_TPP
+# define WORK_STEALING_DEQUE_TPP
+
+/* Public Methods */
+
+template <typename TType>
+WorkStealingDeque<TType>::WorkStealingDeque(size_t capacity) : _top(0), _bottom(0), _buffer(nullptr)
+{
+	int64_t rounded = 2;
+	while (rounded < static_cast<int64_t>(capacity))
+		rounded <<= 1;
+
+	_buffers.emplace_back(new Buffer(rounded));
+	_buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+template <typename TType>
+void WorkStealingDeque<TType>::push(TType value)
+{
+	int64_t bottom = _bottom.load(std::memory_order_relaxed);
+	int64_t top = _top.load(std::memory_order_acquire);
+	Buffer *buffer = _buffer.load(std::memory_order_relaxed);
+
+	if (bottom - top > buffer->capacity - 1)
+		buffer = grow(buffer, bottom, top);
+
+	buffer->put(bottom, value);
+	std::atomic_thread_fence(std::memory_order_release);
+	_bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+template <typename TType>
+bool WorkStealingDeque<TType>::take(TType &value) noexcept
+{
+	int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+	Buffer *buffer = _buffer.load(std::memory_order_relaxed);
+
+	_bottom.store(bottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t top = _top.load(std::memory_order_relaxed);
+
+	if (top > bottom) {
+		_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return false;
+	}
+
+	value = buffer->get(bottom);
+	if (top == bottom) {
+		// Last element: race against stealers for it
+		bool won = _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return won;
+	}
+	return true;
+}
+
+template <typename TType>
+bool WorkStealingDeque<TType>::steal(TType &value) noexcept
+{
+	int64_t top = _top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+	if (top >= bottom)
+		return false;
+
+	Buffer *buffer = _buffer.load(std::memory_order_acquire);
+	TType stolen = buffer->get(top);
+	if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		return false;
+
+	value = stolen;
+	return true;
+}
+
+template <typename TType>
+bool WorkStealingDeque<TType>::empty() const noexcept
+{
+	return size() == 0;
+}
+
+template <typename TType>
+size_t WorkStealingDeque<TType>::size() const noexcept
+{
+	int64_t bottom = _bottom.load(std::memory_order_relaxed);
+	int64_t top = _top.load(std::memory_order_relaxed);
+
+	return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+/* Private Methods */
+
+template <typename TType>
+WorkStealingDeque<TType>::Buffer::Buffer(int64_t size) : capacity(size), mask(size - 1), slots(new std::atomic<TType>[size])
+{
+}
+
+template <typename TType>
+void WorkStealingDeque<TType>::Buffer::put(int64_t index, TType value) noexcept
+{
+	slots[index & mask].store(value, std::memory_order_relaxed);
+}
+
+template <typename TType>
+TType WorkStealingDeque<TType>::Buffer::get(int64_t index) const noexcept
+{
+	return slots[index & mask].load(std::memory_order_relaxed);
+}
+
+template <typename TType>
+typename WorkStealingDeque<TType>::Buffer *WorkStealingDeque<TType>::grow(Buffer *old, int64_t bottom, int64_t top)
+{
+	Buffer *bigger = new Buffer(old->capacity * 2);
+
+	for (int64_t i = top; i < bottom; i++)
+		bigger->put(i, old->get(i));
+
+	_buffers.emplace_back(bigger);
+	_buffer.store(bigger, std::memory_order_release);
+	return bigger;
+}
+
+#endif
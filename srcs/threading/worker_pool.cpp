@@ -6,61 +6,625 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/11 14:12:55 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/19 16:36:47 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 02:47:57 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../inc/threading/worker_pool.hpp"
 
+#include <future>
+
+#if defined(__x86_64__) || defined(__i386__)
+# include <immintrin.h>
+#endif
+
+namespace
+{
+	thread_local WorkerPool *t_currentPool = nullptr;
+	thread_local size_t t_workerIndex = 0;
+	thread_local uint64_t t_stealSeed = 0;
+
+	const size_t NODE_CACHE_LIMIT = 256;
+	const size_t NODE_BATCH = 64;
+
+	inline void cpuRelax() noexcept
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		_mm_pause();
+#elif defined(__aarch64__)
+		asm volatile("yield" ::: "memory");
+#endif
+	}
+
+	inline size_t nextVictim(size_t count) noexcept
+	{
+		if (t_stealSeed == 0)
+			t_stealSeed = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+		t_stealSeed ^= t_stealSeed << 13;
+		t_stealSeed ^= t_stealSeed >> 7;
+		t_stealSeed ^= t_stealSeed << 17;
+		return static_cast<size_t>(t_stealSeed % count);
+	}
+}
+
+/*
+** Recycled job nodes. Each thread keeps a small free list; surplus nodes go
+** back to a shared depot in batches, and an empty cache refills from it.
+** Fresh nodes are only allocated while the caches warm up.
+*/
+struct WorkerPoolNodeDepot
+{
+	std::mutex mutex;
+	std::vector<WorkerPool::JobNode *> nodes;
+
+	~WorkerPoolNodeDepot();
+};
+
+struct WorkerPoolNodeCache
+{
+	std::vector<WorkerPool::JobNode *> nodes;
+
+	~WorkerPoolNodeCache();
+};
+
+namespace
+{
+	WorkerPoolNodeDepot &nodeDepot()
+	{
+		static WorkerPoolNodeDepot depot;
+		return depot;
+	}
+
+	thread_local WorkerPoolNodeCache t_nodeCache;
+}
+
 /* Public Methods */
 
-WorkerPool::WorkerPool(size_t numWorkers) : _running(true)
+WorkerPool::WorkerPool(size_t numWorkers) : WorkerPool(numWorkers, Config())
 {
-	_workers.reserve(numWorkers);
-	for (size_t i = 0; i < numWorkers; i++) {
-		_workers.emplace_back(&WorkerPool::workerRoutine, this);
+}
+
+WorkerPool::WorkerPool(size_t numWorkers, const Config &config) : _config(config), _running(true), _pendingJobs(0), _unfinishedJobs(0), _idleWaiters(0), _sleepers(0), _elastic(false), _activeWorkers(0), _peakWorkers(0), _grown(0), _retired(0), _lastGrowth(std::chrono::steady_clock::now()), _supervisorIdle(false)
+{
+	if (_config.idlePolicy == IdlePolicy::LATENCY) {
+		_spinLimit = 4096;
+		_yieldLimit = 256;
+	} else {
+		_spinLimit = 64;
+		_yieldLimit = 4;
+	}
+
+	if (_config.maxWorkers == 0) {
+		_config.minWorkers = numWorkers;
+		_config.maxWorkers = numWorkers;
 	}
+	if (_config.minWorkers > _config.maxWorkers)
+		throw std::runtime_error("WorkerPool minWorkers exceeds maxWorkers");
+	numWorkers = std::min(std::max(numWorkers, _config.minWorkers), _config.maxWorkers);
+	_elastic = _config.maxWorkers > _config.minWorkers;
+	if (_config.workerAttributes.name.empty())
+		_config.workerAttributes.name = "ftpp-worker";
+	if (_config.pinWorkers && _config.workerAttributes.cpus.empty())
+		_config.workerAttributes.cpus = ThreadAttributes::availableCpus();
+#if LIBFTPP_POOL_STATS
+	if (_config.recordStats || _elastic)
+		CycleClock::ticksPerNanosecond();
+#else
+	_config.recordStats = false;
+#endif
+
+	_workers.reserve(_config.maxWorkers);
+	for (size_t i = 0; i < _config.maxWorkers; i++)
+		_workers.emplace_back(new Worker());
+	try {
+		std::lock_guard<std::mutex> lock(_resizeMutex);
+		for (size_t i = 0; i < numWorkers; i++)
+			startWorker(i);
+	} catch (...) {
+		shutdown();
+		throw;
+	}
+	if (_elastic)
+		_supervisor = std::thread(&WorkerPool::supervisorRoutine, this);
 }
 
 WorkerPool::~WorkerPool()
 {
-	_running.store(false);
-	for (auto& worker : _workers) {
-		if (worker.joinable())
-			worker.join();
+	shutdown();
+}
+
+void WorkerPool::shutdown() noexcept
+{
+	TimerQueue *timers = nullptr;
+
+	{
+		std::lock_guard<std::mutex> lock(_timersMutex);
+		timers = _timers.get();
+	}
+	// Stopped unlocked: dropped sleepFor jobs resume their coroutines here
+	if (timers)
+		timers->stop();
+	{
+		std::lock_guard<std::mutex> lock(_parkMutex);
+		_running.store(false);
+	}
+	_parkCondition.notify_all();
+	{
+		std::lock_guard<std::mutex> lock(_supervisorMutex);
 	}
-	_jobQueue.clear();
+	_supervisorCondition.notify_all();
+	if (_supervisor.joinable())
+		_supervisor.join();
+	for (auto &worker : _workers) {
+		if (worker->thread.joinable())
+			worker->thread.join();
+	}
+
+	JobNode *node = nullptr;
+	for (auto &worker : _workers) {
+		while (worker->deque.take(node))
+			releaseNode(node);
+	}
+	while ((node = _injectQueue.pop()))
+		releaseNode(node);
 }
 
 void WorkerPool::addJob(const std::function<void()> &job)
 {
-	_jobQueue.push_back(job);
+	if (job)
+		enqueue(Job(job));
 }
 
 void WorkerPool::addJob(std::unique_ptr<IJobs> job)
 {
-	if (job) {
-		std::shared_ptr<IJobs> sharedJob = std::move(job);
-		_jobQueue.push_back([sharedJob]() { sharedJob->execute(); });
+	if (job)
+		enqueue(Job([job = std::move(job)]() { job->execute(); }));
+}
+
+size_t WorkerPool::pendingTimers() const
+{
+	std::lock_guard<std::mutex> lock(_timersMutex);
+
+	return _timers ? _timers->pending() : 0;
+}
+
+void WorkerPool::waitAll()
+{
+	if (isWorkerThread())
+		throw std::runtime_error("waitAll called from a worker thread");
+
+	std::unique_lock<std::mutex> lock(_idleMutex);
+	_idleWaiters.fetch_add(1);
+	_idleCondition.wait(lock, [this]() { return _unfinishedJobs.load() == 0 || !_running.load(); });
+	_idleWaiters.fetch_sub(1);
+}
+
+const WorkerPool::Config &WorkerPool::getConfig() const noexcept
+{
+	return _config;
+}
+
+size_t WorkerPool::size() const noexcept
+{
+	return _activeWorkers.load();
+}
+
+bool WorkerPool::isElastic() const noexcept
+{
+	return _elastic;
+}
+
+WorkerPool::Stats WorkerPool::stats() const
+{
+	Stats stats;
+	double ticksPerNanosecond = _config.recordStats ? CycleClock::ticksPerNanosecond() : 1.0;
+	uint64_t now = CycleClock::now();
+
+	stats.workers = _activeWorkers.load();
+	stats.peakWorkers = _peakWorkers.load();
+	stats.grown = _grown.load();
+	stats.retired = _retired.load();
+	stats.queueDepth = std::max<int64_t>(0, _pendingJobs.load());
+	stats.jobsCompleted = 0;
+	stats.perWorker.reserve(_workers.size());
+
+	std::lock_guard<std::mutex> lock(_resizeMutex);
+	for (const auto &worker : _workers) {
+		const Worker::Metrics &metrics = worker->metrics;
+		uint64_t started = metrics.startTick.load(std::memory_order_relaxed);
+		WorkerStats workerStats;
+
+		workerStats.active = worker->active;
+		workerStats.jobsCompleted = metrics.jobsCompleted.load(std::memory_order_relaxed);
+		workerStats.busyRatio = started && now > started
+			? static_cast<double>(metrics.busyTicks.load(std::memory_order_relaxed)) / (now - started) : 0.0;
+		workerStats.wait = metrics.wait.snapshot(ticksPerNanosecond);
+		workerStats.execution = metrics.execution.snapshot(ticksPerNanosecond);
+
+		stats.jobsCompleted += workerStats.jobsCompleted;
+		stats.wait.merge(workerStats.wait);
+		stats.execution.merge(workerStats.execution);
+		stats.perWorker.push_back(workerStats);
 	}
+	return stats;
+}
+
+bool WorkerPool::isWorkerThread() const noexcept
+{
+	return t_currentPool == this;
 }
 
 /* Private Methods */
 
-void WorkerPool::workerRoutine()
+WorkerPool::JobNode *WorkerPool::acquireNode()
+{
+	std::vector<JobNode *> &cache = t_nodeCache.nodes;
+
+	if (cache.empty()) {
+		WorkerPoolNodeDepot &depot = nodeDepot();
+		std::lock_guard<std::mutex> lock(depot.mutex);
+		size_t batch = std::min(NODE_BATCH, depot.nodes.size());
+		cache.insert(cache.end(), depot.nodes.end() - batch, depot.nodes.end());
+		depot.nodes.resize(depot.nodes.size() - batch);
+	}
+	if (cache.empty())
+		return new JobNode();
+
+	JobNode *node = cache.back();
+	cache.pop_back();
+	return node;
+}
+
+void WorkerPool::releaseNode(JobNode *node) noexcept
+{
+	std::vector<JobNode *> &cache = t_nodeCache.nodes;
+
+	node->job.reset();
+	node->next = nullptr;
+	if (cache.size() >= NODE_CACHE_LIMIT) {
+		WorkerPoolNodeDepot &depot = nodeDepot();
+		std::lock_guard<std::mutex> lock(depot.mutex);
+		depot.nodes.insert(depot.nodes.end(), cache.end() - NODE_BATCH, cache.end());
+		cache.resize(cache.size() - NODE_BATCH);
+	}
+	cache.push_back(node);
+}
+
+void WorkerPool::enqueue(Job &&job)
+{
+	JobNode *node = acquireNode();
+	node->job = std::move(job);
+	if (_elastic || _config.recordStats)
+		node->enqueuedAt = CycleClock::now();
+
+	// Counted before publication so a parked worker never misses it
+	_unfinishedJobs.fetch_add(1);
+	_pendingJobs.fetch_add(1);
+	if (isWorkerThread()) {
+		_workers[t_workerIndex]->deque.push(node);
+	} else {
+		_injectQueue.push(node);
+	}
+	wakeOne();
+
+	// Same seq_cst pairing as park(): an idle supervisor either sees the
+	// unfinished job or we see it idle and wake it.
+	if (_elastic && _supervisorIdle.load()) {
+		std::lock_guard<std::mutex> lock(_supervisorMutex);
+		_supervisorCondition.notify_one();
+	}
+}
+
+void WorkerPool::workerRoutine(size_t index)
 {
+	size_t idleRounds = 0;
+
+	t_currentPool = this;
+	t_workerIndex = index;
+
 	while (_running.load()) {
-		if (_jobQueue.empty())
-			continue;
+		if (runPendingJob())
+			idleRounds = 0;
+		else if (!idle(idleRounds))
+			break;
+	}
+
+	t_currentPool = nullptr;
+}
 
+bool WorkerPool::runPendingJob()
+{
+	JobNode *node = findJob();
+
+	if (!node)
+		return false;
+
+#if LIBFTPP_POOL_STATS
+	Worker::Metrics *metrics = _config.recordStats && isWorkerThread() ? &_workers[t_workerIndex]->metrics : nullptr;
+	uint64_t enqueuedAt = node->enqueuedAt;
+	uint64_t started = metrics ? CycleClock::now() : 0;
+#endif
+
+	try {
+		if (node->job)
+			node->job();
+	} catch (const std::exception &e) {
+		threadSafeCout << "Worker encountered an error: " << e.what() << std::endl;
+	}
+	releaseNode(node);
+
+#if LIBFTPP_POOL_STATS
+	// Only the owning worker writes its metrics, so plain stores suffice
+	if (metrics) {
+		uint64_t finished = CycleClock::now();
+		metrics->wait.record(started > enqueuedAt ? started - enqueuedAt : 0);
+		metrics->execution.record(finished - started);
+		metrics->busyTicks.store(metrics->busyTicks.load(std::memory_order_relaxed) + (finished - started), std::memory_order_relaxed);
+		metrics->jobsCompleted.store(metrics->jobsCompleted.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	}
+#endif
+
+	if (_unfinishedJobs.fetch_sub(1) == 1 && _idleWaiters.load() > 0) {
+		std::lock_guard<std::mutex> lock(_idleMutex);
+		_idleCondition.notify_all();
+	}
+	return true;
+}
+
+WorkerPool::JobNode *WorkerPool::findJob()
+{
+	JobNode *job = nullptr;
+
+	if (isWorkerThread() && _workers[t_workerIndex]->deque.take(job)) {
+		_pendingJobs.fetch_sub(1);
+		return job;
+	}
+	if ((job = _injectQueue.pop())) {
+		_pendingJobs.fetch_sub(1);
+		return job;
+	}
+
+	size_t count = _workers.size();
+	size_t start = nextVictim(count);
+	for (size_t i = 0; i < count; i++) {
+		Worker &victim = *_workers[(start + i) % count];
+		if (victim.deque.steal(job)) {
+			_pendingJobs.fetch_sub(1);
+			return job;
+		}
+	}
+	return nullptr;
+}
+
+bool WorkerPool::idle(size_t &idleRounds)
+{
+	if (idleRounds < _spinLimit) {
+		cpuRelax();
+		idleRounds++;
+	} else if (idleRounds < _spinLimit + _yieldLimit) {
+		std::this_thread::yield();
+		idleRounds++;
+	} else {
+		idleRounds = 0;
+		return park();
+	}
+	return true;
+}
+
+/*
+** Returns false when the calling worker retired and must exit.
+*/
+bool WorkerPool::park()
+{
+	std::unique_lock<std::mutex> lock(_parkMutex);
+	auto ready = [this]() { return !_running.load() || _pendingJobs.load() > 0; };
+	bool keepRunning = true;
+
+	// Sleeper count and pending count are both seq_cst: a concurrent enqueue
+	// either sees this sleeper or we see its pending job.
+	_sleepers.fetch_add(1);
+	if (!_elastic)
+		_parkCondition.wait(lock, ready);
+	else if (!_parkCondition.wait_for(lock, _config.idleTimeout, ready))
+		keepRunning = !tryRetire();
+	_sleepers.fetch_sub(1);
+	return keepRunning;
+}
+
+void WorkerPool::wakeOne()
+{
+	if (_sleepers.load() == 0)
+		return;
+
+	std::lock_guard<std::mutex> lock(_parkMutex);
+	_parkCondition.notify_one();
+}
+
+/*
+** Caller holds _resizeMutex. A slot left by a retired worker is reused once
+** its thread has been joined. The worker applies its attributes before
+** taking jobs; a placement failure is rethrown here.
+*/
+void WorkerPool::startWorker(size_t index)
+{
+	Worker &worker = *_workers[index];
+	ThreadAttributes attributes = _config.workerAttributes;
+	std::promise<void> placed;
+	std::future<void> result = placed.get_future();
+	size_t count;
+
+	attributes.name += "-" + std::to_string(index);
+	if (_config.pinWorkers)
+		attributes.cpus = { _config.workerAttributes.cpus[index % _config.workerAttributes.cpus.size()] };
+
+	if (worker.thread.joinable())
+		worker.thread.join();
+	if (worker.metrics.startTick.load() == 0)
+		worker.metrics.startTick.store(CycleClock::now());
+	worker.active = true;
+	count = _activeWorkers.fetch_add(1) + 1;
+	worker.thread = std::thread([this, index, attributes, placed = std::move(placed)]() mutable {
 		try {
-			auto job = _jobQueue.pop_front();
-			if (job) 
-				job();
-			
-		} catch (const std::runtime_error &e) {
-			threadSafeCout << "Worker encountered an error: " << e.what() << std::endl;
-			break;
+			attributes.applyToCurrentThread();
+		} catch (...) {
+			placed.set_exception(std::current_exception());
+			return;
+		}
+		placed.set_value();
+		workerRoutine(index);
+	});
+
+	try {
+		result.get();
+	} catch (...) {
+		worker.thread.join();
+		worker.active = false;
+		_activeWorkers.fetch_sub(1);
+		throw;
+	}
+	if (count > _peakWorkers.load())
+		_peakWorkers.store(count);
+}
+
+bool WorkerPool::grow()
+{
+	std::lock_guard<std::mutex> lock(_resizeMutex);
+
+	for (size_t i = 0; i < _workers.size(); i++) {
+		if (!_workers[i]->active) {
+			startWorker(i);
+			_grown.fetch_add(1);
+			_lastGrowth = std::chrono::steady_clock::now();
+			return true;
+		}
+	}
+	return false;
+}
+
+/*
+** Called by a worker whose park timed out. Its own deque is empty, since
+** only the owner pushes there and it is not running a job.
+*/
+bool WorkerPool::tryRetire()
+{
+	std::lock_guard<std::mutex> lock(_resizeMutex);
+
+	if (_activeWorkers.load() <= _config.minWorkers)
+		return false;
+	if (std::chrono::steady_clock::now() - _lastGrowth < _config.resizeCooldown)
+		return false;
+	// A job queued after the park timed out would wake nobody but us
+	if (_pendingJobs.load() > 0)
+		return false;
+	_workers[t_workerIndex]->active = false;
+	_activeWorkers.fetch_sub(1);
+	_retired.fetch_add(1);
+	return true;
+}
+
+bool WorkerPool::shouldGrow()
+{
+	uint64_t oldest;
+	uint64_t now;
+	size_t active = _activeWorkers.load();
+
+	if (active >= _config.maxWorkers || _pendingJobs.load() <= 0)
+		return false;
+	if (active == 0)
+		return true;
+	if (!_injectQueue.oldest(oldest))
+		return false;
+	now = CycleClock::now();
+	return now > oldest && now - oldest >= CycleClock::fromDuration(_config.growThreshold);
+}
+
+void WorkerPool::supervisorRoutine()
+{
+	auto tick = std::max<std::chrono::steady_clock::duration>(std::chrono::milliseconds(1), _config.growThreshold / 4);
+	std::unique_lock<std::mutex> lock(_supervisorMutex);
+	ThreadAttributes attributes;
+	bool growthFailed = false;
+
+	attributes.name = _config.workerAttributes.name + "-sup";
+	try {
+		attributes.applyToCurrentThread();
+	} catch (const std::exception &) {
+		// Naming the supervisor is cosmetic
+	}
+
+	while (_running.load()) {
+		if (_unfinishedJobs.load() == 0) {
+			_supervisorIdle.store(true);
+			_supervisorCondition.wait(lock, [this]() { return !_running.load() || _unfinishedJobs.load() > 0; });
+			_supervisorIdle.store(false);
+		} else {
+			_supervisorCondition.wait_for(lock, tick, [this]() { return !_running.load(); });
 		}
+		if (growthFailed || !_running.load() || !shouldGrow())
+			continue;
+		try {
+			grow();
+		} catch (const std::exception &e) {
+			threadSafeCout << "WorkerPool failed to grow, resizing disabled: " << e.what() << std::endl;
+			growthFailed = true;
+		}
+	}
+}
+
+TimerQueue &WorkerPool::timers()
+{
+	std::lock_guard<std::mutex> lock(_timersMutex);
+
+	if (!_timers)
+		_timers.reset(new TimerQueue(*this, _config.workerAttributes.name + "-tmr"));
+	return *_timers;
+}
+
+void WorkerPool::InjectQueue::push(JobNode *node) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	node->next = nullptr;
+	if (_tail)
+		_tail->next = node;
+	else
+		_head = node;
+	_tail = node;
+}
+
+WorkerPool::JobNode *WorkerPool::InjectQueue::pop() noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	JobNode *node = _head;
+
+	if (node) {
+		_head = node->next;
+		if (!_head)
+			_tail = nullptr;
 	}
-}
\ No newline at end of file
+	return node;
+}
+
+bool WorkerPool::InjectQueue::oldest(uint64_t &enqueuedAt) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (!_head)
+		return false;
+	enqueuedAt = _head->enqueuedAt;
+	return true;
+}
+
+/* Node depot */
+
+WorkerPoolNodeDepot::~WorkerPoolNodeDepot()
+{
+	for (WorkerPool::JobNode *node : nodes)
+		delete node;
+}
+
+WorkerPoolNodeCache::~WorkerPoolNodeCache()
+{
+	std::lock_guard<std::mutex> lock(nodeDepot().mutex);
+	nodeDepot().nodes.insert(nodeDepot().nodes.end(), nodes.begin(), nodes.end());
+}
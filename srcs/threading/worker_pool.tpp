@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   worker_pool.tpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:04:29 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 02:35:46 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef WORKER_POOL_TPP
+# define WORKER_POOL_TPP
+
+template <typename TFunction, typename>
+void WorkerPool::addJob(TFunction &&function)
+{
+	enqueue(Job(std::forward<TFunction>(function)));
+}
+
+template <typename TFunction, typename ... TArgs>
+Future<typename std::invoke_result<typename std::decay<TFunction>::type, typename std::decay<TArgs>::type ...>::type> WorkerPool::submit(TFunction &&function, TArgs && ... args)
+{
+	using TResult = typename std::invoke_result<typename std::decay<TFunction>::type, typename std::decay<TArgs>::type ...>::type;
+
+	// A job dropped by shutdown() destroys the promise, which breaks it
+	Promise<TResult> promise;
+	Future<TResult> future = promise.getFuture(this);
+	std::tuple<typename std::decay<TFunction>::type, typename std::decay<TArgs>::type ...> bound(std::forward<TFunction>(function), std::forward<TArgs>(args)...);
+
+	addJob([promise = std::move(promise), bound = std::move(bound)]() mutable {
+		FutureDetail::fulfill(*FutureDetail::Access::state(promise), [&]() -> TResult {
+			return std::apply([](auto &callable, auto & ... values) -> TResult {
+				return std::invoke(std::move(callable), std::move(values)...);
+			}, bound);
+		});
+	});
+	return future;
+}
+
+template <typename TRep, typename TPeriod, typename TFunction>
+TimerHandle WorkerPool::schedule(const std::chrono::duration<TRep, TPeriod> &delay, TFunction &&function)
+{
+	auto due = TimerQueue::Clock::now() + std::chrono::ceil<TimerQueue::Clock::duration>(delay);
+
+	return timers().add(due, TimerQueue::Clock::duration::zero(), Job(std::forward<TFunction>(function)));
+}
+
+template <typename TRep, typename TPeriod, typename TFunction>
+TimerHandle WorkerPool::scheduleEvery(const std::chrono::duration<TRep, TPeriod> &period, TFunction &&function)
+{
+	auto interval = std::chrono::ceil<TimerQueue::Clock::duration>(period);
+
+	if (interval <= TimerQueue::Clock::duration::zero())
+		throw std::runtime_error("Timer period must be positive");
+	return timers().add(TimerQueue::Clock::now() + interval, interval, Job(std::forward<TFunction>(function)));
+}
+
+#if LIBFTPP_COROUTINES
+
+/*
+** The handle may resume on a worker before await_suspend returns, so the
+** awaitable is not touched after handing it over. A job that cannot be
+** queued is destroyed during unwinding, which already resumed the
+** coroutine with ECANCELED: the exception must not escape await_suspend.
+*/
+inline WorkerPool::ScheduleAwaitable::ScheduleAwaitable(WorkerPool &pool) noexcept : _pool(pool), _error(0)
+{
+}
+
+inline bool WorkerPool::ScheduleAwaitable::await_ready() const noexcept
+{
+	return false;
+}
+
+inline void WorkerPool::ScheduleAwaitable::await_suspend(std::coroutine_handle<> handle)
+{
+	ResumeJob job(handle, &_error);
+
+	try {
+		_pool.addJob(std::move(job));
+	} catch (...) {
+	}
+}
+
+inline void WorkerPool::ScheduleAwaitable::await_resume() const
+{
+	if (_error)
+		throw std::system_error(_error, std::generic_category(), "WorkerPool stopped before the coroutine resumed");
+}
+
+inline WorkerPool::DelayAwaitable::DelayAwaitable(WorkerPool &pool, TimerQueue::Clock::duration delay) noexcept : _pool(pool), _delay(delay), _error(0)
+{
+}
+
+inline bool WorkerPool::DelayAwaitable::await_ready() const noexcept
+{
+	return _delay <= TimerQueue::Clock::duration::zero();
+}
+
+inline void WorkerPool::DelayAwaitable::await_suspend(std::coroutine_handle<> handle)
+{
+	Job job(ResumeJob(handle, &_error));
+	auto due = TimerQueue::Clock::now() + _delay;
+
+	try {
+		_pool.timers().add(due, TimerQueue::Clock::duration::zero(), std::move(job));
+	} catch (...) {
+	}
+}
+
+inline void WorkerPool::DelayAwaitable::await_resume() const
+{
+	if (_error)
+		throw std::system_error(_error, std::generic_category(), "WorkerPool stopped before the delay elapsed");
+}
+
+inline WorkerPool::ResumeJob::ResumeJob(std::coroutine_handle<> handle, int *error) noexcept : _handle(handle), _error(error)
+{
+}
+
+inline WorkerPool::ResumeJob::ResumeJob(ResumeJob &&other) noexcept : _handle(std::exchange(other._handle, nullptr)), _error(other._error)
+{
+}
+
+inline WorkerPool::ResumeJob::~ResumeJob() noexcept
+{
+	if (!_handle)
+		return;
+	if (_error)
+		*_error = ECANCELED;
+	_handle.resume();
+}
+
+inline void WorkerPool::ResumeJob::operator()()
+{
+	std::exchange(_handle, nullptr).resume();
+}
+
+inline WorkerPool::ScheduleAwaitable WorkerPool::schedule() noexcept
+{
+	return ScheduleAwaitable(*this);
+}
+
+template <typename TRep, typename TPeriod>
+WorkerPool::DelayAwaitable WorkerPool::sleepFor(const std::chrono::duration<TRep, TPeriod> &delay) noexcept
+{
+	return DelayAwaitable(*this, std::chrono::ceil<TimerQueue::Clock::duration>(delay));
+}
+
+#endif
+
+#endif
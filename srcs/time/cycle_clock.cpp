@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cycle_clock.cpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:25:35 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:46:27 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/time/cycle_clock.hpp"
+
+#include <thread>
+
+namespace
+{
+	double calibrate() noexcept
+	{
+#if defined(__x86_64__) || defined(__i386__)
+		auto wallStart = std::chrono::steady_clock::now();
+		uint64_t tickStart = CycleClock::now();
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		uint64_t ticks = CycleClock::now() - tickStart;
+		double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - wallStart).count();
+
+		return ticks > 0 && nanoseconds > 0 ? ticks / nanoseconds : 1.0;
+#else
+		return 1.0;
+#endif
+	}
+}
+
+/* Public Methods */
+
+double CycleClock::ticksPerNanosecond() noexcept
+{
+	static const double ratio = calibrate();
+
+	return ratio;
+}
+
+double CycleClock::toNanoseconds(uint64_t ticks) noexcept
+{
+	return ticks / ticksPerNanosecond();
+}
+
+uint64_t CycleClock::fromDuration(std::chrono::nanoseconds duration) noexcept
+{
+	return static_cast<uint64_t>(duration.count() * ticksPerNanosecond());
+}
+
+CycleClock::WallAnchor::WallAnchor() noexcept : wall(std::chrono::system_clock::now()), ticks(CycleClock::now())
+{
+}
+
+// Ticks on either side of the anchor are both fine
+std::chrono::system_clock::time_point CycleClock::WallAnchor::toWallClock(uint64_t stamp) const noexcept
+{
+	double nanoseconds = static_cast<double>(static_cast<int64_t>(stamp - ticks)) / ticksPerNanosecond();
+
+	return wall + std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::duration<double, std::nano>(nanoseconds));
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   latency_histogram.cpp                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 22:25:35 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 22:25:35 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/time/latency_histogram.hpp"
+
+#include <algorithm>
+
+/* Public Methods */
+
+LatencyHistogram::LatencyHistogram() noexcept : _count(0), _sum(0), _max(0)
+{
+	for (auto &bucket : _buckets)
+		bucket.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot(double ticksPerNanosecond) const noexcept
+{
+	Snapshot snapshot;
+
+	for (size_t i = 0; i < BucketCount; i++)
+		snapshot.buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+	snapshot.count = _count.load(std::memory_order_relaxed);
+	snapshot.sum = _sum.load(std::memory_order_relaxed) / ticksPerNanosecond;
+	snapshot.max = _max.load(std::memory_order_relaxed) / ticksPerNanosecond;
+	snapshot.ticksPerNanosecond = ticksPerNanosecond;
+	return snapshot;
+}
+
+uint64_t LatencyHistogram::bucketLowerBound(size_t index) noexcept
+{
+	if (index < 4)
+		return index;
+	size_t msb = index / 4 + 1;
+	return static_cast<uint64_t>(4 + index % 4) << (msb - 2);
+}
+
+/* Snapshot */
+
+void LatencyHistogram::Snapshot::merge(const Snapshot &other) noexcept
+{
+	for (size_t i = 0; i < BucketCount; i++)
+		buckets[i] += other.buckets[i];
+	count += other.count;
+	sum += other.sum;
+	max = std::max(max, other.max);
+	if (other.count)
+		ticksPerNanosecond = other.ticksPerNanosecond;
+}
+
+double LatencyHistogram::Snapshot::mean() const noexcept
+{
+	return count ? sum / count : 0.0;
+}
+
+/*
+** Midpoint of the bucket holding the requested rank, in nanoseconds and
+** capped by the recorded maximum.
+*/
+double LatencyHistogram::Snapshot::percentile(double fraction) const noexcept
+{
+	uint64_t total = 0;
+	uint64_t rank;
+
+	for (uint64_t bucket : buckets)
+		total += bucket;
+	if (total == 0)
+		return 0.0;
+	rank = static_cast<uint64_t>(std::clamp(fraction, 0.0, 1.0) * (total - 1));
+
+	for (size_t i = 0; i < BucketCount; i++) {
+		if (rank < buckets[i]) {
+			double low = static_cast<double>(bucketLowerBound(i));
+			double high = i + 1 < BucketCount ? static_cast<double>(bucketLowerBound(i + 1)) : low;
+			return std::min(max, (low + high) / 2 / ticksPerNanosecond);
+		}
+		rank -= buckets[i];
+	}
+	return max;
+}
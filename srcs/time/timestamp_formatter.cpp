@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timestamp_formatter.cpp                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:02:47 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 00:02:47 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/time/timestamp_formatter.hpp"
+
+#include <cstring>
+#include <ctime>
+#include <limits>
+
+constexpr size_t TimestampFormatter::MaxLength;
+
+TimestampFormatter::TimestampFormatter(Precision precision) noexcept
+	: _precision(precision), _cachedSecond(std::numeric_limits<int64_t>::min()), _cachedText()
+{
+}
+
+/*
+ * Seconds are floored so that times before the epoch keep non-negative
+ * sub-second digits.
+ */
+size_t TimestampFormatter::format(std::chrono::system_clock::time_point time, char *out) noexcept
+{
+	int64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+	int64_t second = micros / 1000000;
+	int64_t fraction = micros % 1000000;
+
+	if (fraction < 0) {
+		fraction += 1000000;
+		--second;
+	}
+	if (second != _cachedSecond) {
+		std::time_t seconds = static_cast<std::time_t>(second);
+		struct tm calendar;
+		if (!localtime_r(&seconds, &calendar) || std::strftime(_cachedText, sizeof(_cachedText), "%Y-%m-%d %H:%M:%S", &calendar) != 19)
+			std::memset(_cachedText, '?', 19);
+		_cachedSecond = second;
+	}
+	std::memcpy(out, _cachedText, 19);
+	if (_precision == Precision::SECONDS)
+		return 19;
+
+	size_t digits = _precision == Precision::MILLISECONDS ? 3 : 6;
+	if (digits == 3)
+		fraction /= 1000;
+	out[19] = '.';
+	for (size_t i = digits; i > 0; --i) {
+		out[19 + i] = static_cast<char>('0' + fraction % 10);
+		fraction /= 10;
+	}
+	return 20 + digits;
+}
+
+void TimestampFormatter::append(std::string &out, std::chrono::system_clock::time_point time)
+{
+	char text[MaxLength];
+
+	out.append(text, format(time, text));
+}
+
+TimestampFormatter::Precision TimestampFormatter::precision() const noexcept
+{
+	return _precision;
+}
+
+TimestampFormatter &TimestampFormatter::perThread() noexcept
+{
+	thread_local TimestampFormatter formatter;
+
+	return formatter;
+}
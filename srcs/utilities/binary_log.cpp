@@ -0,0 +1,471 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   binary_log.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:40:51 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 01:02:39 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/utilities/binary_log.hpp"
+#include "../../inc/time/timestamp_formatter.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+** File layout: a "FTPPBLOG" magic and a version at every start, then
+** tagged records. 'S' and 'L' define a call site or a logger the first
+** time an entry refers to it; 'E' is one entry. Integers are host-endian,
+** strings a 32-bit length and their bytes.
+*/
+static const char Magic[8] = {'F', 'T', 'P', 'P', 'B', 'L', 'O', 'G'};
+static const uint32_t FormatVersion = 1;
+
+struct Log::BinaryLog::Backend
+{
+	std::mutex lifecycle;
+	std::mutex mutex;
+	std::condition_variable wake;
+	std::condition_variable progress;
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+	Config config;
+	bool stopping = false;
+	uint64_t passes = 0;
+	uint64_t flushTarget = 0;
+	uint64_t retiredDropped = 0;
+	std::thread thread;
+
+	// Held by the consumer for a whole pass
+	std::mutex decodeMutex;
+	int fd = -1;
+	std::string out;
+	std::unordered_map<const FormatSite *, uint32_t> sites;
+	std::unordered_map<Logger *, uint32_t> loggers;
+	Record record;
+};
+
+namespace
+{
+	// Stops the backend before static destruction reaches loggers and sinks
+	struct ExitStop
+	{
+		~ExitStop() { Log::BinaryLog::stop(); }
+	};
+
+	template <typename TType>
+	void put(std::string &out, TType value)
+	{
+		out.append(reinterpret_cast<const char *>(&value), sizeof(value));
+	}
+
+	void putString(std::string &out, const char *text)
+	{
+		uint32_t length = text ? static_cast<uint32_t>(std::strlen(text)) : 0;
+
+		put(out, length);
+		out.append(text ? text : "", length);
+	}
+
+	void writeAll(int fd, std::string &out)
+	{
+		size_t offset = 0;
+
+		while (offset < out.size()) {
+			ssize_t written = ::write(fd, out.data() + offset, out.size() - offset);
+			if (written < 0 && errno == EINTR)
+				continue;
+			if (written <= 0)
+				break;
+			offset += static_cast<size_t>(written);
+		}
+		out.clear();
+	}
+}
+
+// Lets the consumer free a thread's ring once the thread is gone and the ring is empty
+struct Log::BinaryLog::RetireOnExit
+{
+	std::shared_ptr<ThreadBuffer> buffer;
+
+	~RetireOnExit()
+	{
+		if (buffer)
+			buffer->retired.store(true, std::memory_order_release);
+		_threadBuffer = nullptr;
+	}
+};
+
+Log::BinaryLog::ThreadBuffer::ThreadBuffer(size_t capacity)
+	: data(new char[capacity]), mask(capacity - 1), owner(std::this_thread::get_id()), head(0), writing(false), pending(0), cachedTail(0), dropped(0),
+	  tail(0), retired(false)
+{
+}
+
+Log::BinaryLog::ThreadBuffer::~ThreadBuffer()
+{
+	delete[] data;
+}
+
+/* Public Methods */
+
+void Log::BinaryLog::start()
+{
+	start(Config());
+}
+
+/*
+** Restarts the backend if it is running. The buffer size applies to
+** threads that log for the first time afterwards.
+*/
+void Log::BinaryLog::start(const Config &config)
+{
+	if (config.bufferSize < 4096)
+		throw std::runtime_error("Binary log buffer must hold at least 4096 bytes");
+	if (config.overflow == OverflowPolicy::DROP_OLDEST)
+		throw std::runtime_error("Binary log rings only support BLOCK and DROP_NEWEST");
+	if (config.pollInterval.count() <= 0)
+		throw std::runtime_error("Binary log poll interval must be positive");
+
+	static ExitStop exitStop;
+	Backend &state = backend();
+	stop();
+	std::lock_guard<std::mutex> lifecycle(state.lifecycle);
+
+	int fd = -1;
+	if (!config.path.empty()) {
+		fd = ::open(config.path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+		if (fd < 0)
+			throw std::runtime_error("Failed to open binary log: " + config.path + ": " + std::strerror(errno));
+	}
+	{
+		std::lock_guard<std::mutex> lock(state.decodeMutex);
+		state.fd = fd;
+		state.sites.clear();
+		state.loggers.clear();
+		if (fd >= 0) {
+			state.out.append(Magic, sizeof(Magic));
+			put(state.out, FormatVersion);
+		}
+	}
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		state.config = config;
+		size_t rounded = 4096;
+		while (rounded < config.bufferSize)
+			rounded <<= 1;
+		state.config.bufferSize = rounded;
+		state.stopping = false;
+	}
+	_overflow.store(config.overflow, std::memory_order_relaxed);
+	state.thread = std::thread(&BinaryLog::consumerRoutine);
+	_running.store(true, std::memory_order_release);
+}
+
+/*
+** Drains every ring, closes the file and returns to inline formatting.
+** Writers that saw the backend running finish their entry before the
+** consumer's last pass, so no entry (and no Logger pointer) outlives it.
+*/
+void Log::BinaryLog::stop()
+{
+	Backend &state = backend();
+	std::lock_guard<std::mutex> lifecycle(state.lifecycle);
+
+	if (!state.thread.joinable())
+		return;
+	_running.store(false);
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		buffers = state.buffers;
+	}
+	// Not under the mutex: a BLOCK writer may be waiting for the consumer
+	for (const auto &buffer : buffers) {
+		while (buffer->writing.load(std::memory_order_acquire))
+			std::this_thread::yield();
+	}
+	{
+		std::lock_guard<std::mutex> lock(state.mutex);
+		state.stopping = true;
+	}
+	state.wake.notify_one();
+	state.thread.join();
+
+	std::lock_guard<std::mutex> lock(state.decodeMutex);
+	if (state.fd >= 0) {
+		writeAll(state.fd, state.out);
+		::close(state.fd);
+		state.fd = -1;
+	}
+}
+
+bool Log::BinaryLog::isRunning() noexcept
+{
+	return _running.load(std::memory_order_acquire);
+}
+
+// Waits until every entry logged before the call has been consumed
+void Log::BinaryLog::flush()
+{
+	Backend &state = backend();
+	std::unique_lock<std::mutex> lock(state.mutex);
+
+	if (!state.thread.joinable() || state.stopping)
+		return;
+	// The pass in progress may have missed entries; the next one will not
+	uint64_t target = state.passes + 2;
+	state.flushTarget = std::max(state.flushTarget, target);
+	state.wake.notify_one();
+	state.progress.wait(lock, [&]() { return state.passes >= target || state.stopping; });
+}
+
+uint64_t Log::BinaryLog::droppedEntries() noexcept
+{
+	Backend &state = backend();
+	std::lock_guard<std::mutex> lock(state.mutex);
+	uint64_t dropped = state.retiredDropped;
+
+	for (const auto &buffer : state.buffers)
+		dropped += buffer->dropped.load(std::memory_order_relaxed);
+	return dropped;
+}
+
+// Called by ~Logger once the logger has used LOG_BIN_*
+void Log::BinaryLog::release(Logger *logger)
+{
+	Backend &state = backend();
+
+	flush();
+	std::lock_guard<std::mutex> lock(state.decodeMutex);
+	state.loggers.erase(logger);
+}
+
+/*
+** Prints a file written in path mode as "YYYY-MM-DD HH:MM:SS.mmm [LEVEL]
+** [logger] (file:line) - message" lines. Stops at the first truncated or
+** unknown record.
+*/
+void Log::BinaryLog::decode(std::istream &in, std::ostream &out)
+{
+	struct Site
+	{
+		std::string format, file, function;
+		LogLevel level;
+		int line;
+		std::vector<ArgType> types;
+	};
+	std::unordered_map<uint32_t, Site> sites;
+	std::unordered_map<uint32_t, std::string> loggers;
+	std::string line, message;
+	std::vector<char> args;
+	TimestampFormatter timestamps;
+
+	auto read = [&in](void *target, size_t size) { return static_cast<bool>(in.read(static_cast<char *>(target), static_cast<std::streamsize>(size))); };
+	auto readString = [&](std::string &text) {
+		uint32_t length;
+		if (!read(&length, sizeof(length)))
+			return false;
+		text.resize(length);
+		return length == 0 || read(&text[0], length);
+	};
+
+	char tag;
+	while (in.get(tag)) {
+		if (tag == Magic[0]) {
+			char rest[sizeof(Magic) - 1];
+			uint32_t version;
+			if (!read(rest, sizeof(rest)) || std::memcmp(rest, Magic + 1, sizeof(rest)) != 0 || !read(&version, sizeof(version)) || version != FormatVersion)
+				return;
+			sites.clear();
+			loggers.clear();
+		} else if (tag == 'S') {
+			uint32_t id;
+			uint8_t level, count;
+			int32_t lineNumber;
+			Site site;
+			if (!read(&id, sizeof(id)) || !read(&level, 1) || !read(&count, 1))
+				return;
+			site.types.resize(count);
+			if ((count && !read(site.types.data(), count)) || !read(&lineNumber, sizeof(lineNumber))
+				|| !readString(site.format) || !readString(site.file) || !readString(site.function))
+				return;
+			site.level = static_cast<LogLevel>(level);
+			site.line = lineNumber;
+			sites[id] = std::move(site);
+		} else if (tag == 'L') {
+			uint32_t id;
+			if (!read(&id, sizeof(id)) || !readString(loggers[id]))
+				return;
+		} else if (tag == 'E') {
+			uint32_t siteId, loggerId, argBytes;
+			int64_t nanoseconds;
+			if (!read(&siteId, sizeof(siteId)) || !read(&loggerId, sizeof(loggerId)) || !read(&nanoseconds, sizeof(nanoseconds))
+				|| !read(&argBytes, sizeof(argBytes)))
+				return;
+			args.resize(argBytes + 1);
+			if ((argBytes && !read(args.data(), argBytes)) || !sites.count(siteId))
+				return;
+
+			const Site &site = sites[siteId];
+			message.clear();
+			renderFormat(message, site.format, site.types.data(), site.types.size(), args.data());
+			line.clear();
+			timestamps.append(line, std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(
+				std::chrono::nanoseconds(nanoseconds))));
+			line.append(" [").append(levelName(site.level)).append("] [").append(loggers[loggerId]).append("] (");
+			line.append(site.file).append(1, ':').append(std::to_string(site.line)).append(") - ").append(message).append(1, '\n');
+			out << line;
+		} else {
+			return;
+		}
+	}
+}
+
+/* Private Methods */
+
+Log::BinaryLog::Backend &Log::BinaryLog::backend()
+{
+	// Never destroyed: thread exit handlers may still reach it during shutdown
+	static Backend *state = new Backend();
+
+	return *state;
+}
+
+Log::BinaryLog::ThreadBuffer *Log::BinaryLog::registerThread()
+{
+	static thread_local RetireOnExit guard;
+	Backend &state = backend();
+	std::lock_guard<std::mutex> lock(state.mutex);
+
+	guard.buffer = std::make_shared<ThreadBuffer>(state.config.bufferSize);
+	state.buffers.push_back(guard.buffer);
+	_threadBuffer = guard.buffer.get();
+	return _threadBuffer;
+}
+
+void Log::BinaryLog::writeInline(Logger &logger, const FormatSite &site, const char *args)
+{
+	std::string message;
+
+	renderFormat(message, site.format, site.types, site.argCount, args);
+	logger.log(site.level, message, site.source);
+}
+
+/*
+** One pass reads every ring once. Without a path each entry becomes a
+** Record for its logger; with a path, entries are copied to the file.
+** Retired rings (their thread exited) are dropped once empty.
+*/
+void Log::BinaryLog::consumerRoutine()
+{
+	Backend &state = backend();
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+
+	for (;;) {
+		bool stopping;
+		{
+			std::lock_guard<std::mutex> lock(state.mutex);
+			buffers = state.buffers;
+			stopping = state.stopping;
+		}
+
+		size_t consumed = 0;
+		{
+			std::lock_guard<std::mutex> lock(state.decodeMutex);
+			CycleClock::WallAnchor anchor;
+
+			for (const auto &buffer : buffers) {
+				size_t position = buffer->tail.load(std::memory_order_relaxed);
+				size_t end = buffer->head.load(std::memory_order_acquire);
+
+				while (position != end) {
+					const char *entry = buffer->data + (position & buffer->mask);
+					EntryHeader header;
+
+					std::memcpy(&header.size, entry, sizeof(header.size));
+					if (header.size == 0) {
+						position += buffer->mask + 1 - (position & buffer->mask);
+						continue;
+					}
+					std::memcpy(&header, entry, sizeof(header));
+					const FormatSite &site = *header.site;
+					const char *args = entry + sizeof(header);
+
+					if (state.fd < 0) {
+						Record &record = state.record;
+						record.timestamp = anchor.toWallClock(header.ticks);
+						record.level = site.level;
+						record.message.clear();
+						renderFormat(record.message, site.format, site.types, site.argCount, args);
+						record.source = site.source;
+						record.threadId = buffer->owner;
+						header.logger->dispatch(record);
+					} else {
+						auto known = state.sites.find(&site);
+						if (known == state.sites.end()) {
+							known = state.sites.emplace(&site, static_cast<uint32_t>(state.sites.size())).first;
+							state.out.push_back('S');
+							put(state.out, known->second);
+							put(state.out, static_cast<uint8_t>(site.level));
+							put(state.out, static_cast<uint8_t>(site.argCount));
+							state.out.append(reinterpret_cast<const char *>(site.types), site.argCount);
+							put(state.out, static_cast<int32_t>(site.source.line));
+							putString(state.out, site.format);
+							putString(state.out, site.source.file);
+							putString(state.out, site.source.function);
+						}
+						auto logger = state.loggers.find(header.logger);
+						if (logger == state.loggers.end()) {
+							logger = state.loggers.emplace(header.logger, static_cast<uint32_t>(state.loggers.size())).first;
+							state.out.push_back('L');
+							put(state.out, logger->second);
+							putString(state.out, header.logger->getName().c_str());
+						}
+						state.out.push_back('E');
+						put(state.out, known->second);
+						put(state.out, logger->second);
+						put(state.out, static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+							anchor.toWallClock(header.ticks).time_since_epoch()).count()));
+						put(state.out, header.argBytes);
+						state.out.append(args, header.argBytes);
+						if (state.out.size() >= (1 << 16))
+							writeAll(state.fd, state.out);
+					}
+					position += header.size;
+					++consumed;
+				}
+				buffer->tail.store(position, std::memory_order_release);
+			}
+			if (state.fd >= 0 && !state.out.empty())
+				writeAll(state.fd, state.out);
+		}
+
+		std::unique_lock<std::mutex> lock(state.mutex);
+		auto retired = std::remove_if(state.buffers.begin(), state.buffers.end(), [&state](const std::shared_ptr<ThreadBuffer> &buffer) {
+			if (!buffer->retired.load(std::memory_order_acquire) || buffer->tail.load() != buffer->head.load())
+				return false;
+			state.retiredDropped += buffer->dropped.load(std::memory_order_relaxed);
+			return true;
+		});
+		state.buffers.erase(retired, state.buffers.end());
+		++state.passes;
+		state.progress.notify_all();
+		if (stopping && consumed == 0)
+			return;
+		if (consumed == 0)
+			state.wake.wait_for(lock, state.config.pollInterval, [&]() { return state.stopping || state.flushTarget > state.passes; });
+	}
+}
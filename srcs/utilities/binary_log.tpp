@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   binary_log.tpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:40:14 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 01:02:39 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BINARY_LOG_TPP
+# define BINARY_LOG_TPP
+
+#include <vector>
+
+/*
+** Entries never straddle the end of the ring: when the contiguous space
+** left is too small, a zero size word marks the wrap and the entry starts
+** over at offset 0. Entries over half the ring could wait forever and are
+** always dropped.
+*/
+inline char *Log::BinaryLog::ThreadBuffer::reserve(size_t size, OverflowPolicy overflow) noexcept
+{
+	size_t capacity = mask + 1;
+	size_t position = head.load(std::memory_order_relaxed);
+	size_t contiguous = capacity - (position & mask);
+	size_t needed = size <= contiguous ? size : size + contiguous;
+
+	while (size > capacity / 2 || position + needed - cachedTail > capacity) {
+		cachedTail = tail.load(std::memory_order_acquire);
+		if (size <= capacity / 2 && position + needed - cachedTail <= capacity)
+			break;
+		if (overflow != OverflowPolicy::BLOCK || size > capacity / 2) {
+			dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		std::this_thread::yield();
+	}
+	if (size > contiguous) {
+		uint32_t wrap = 0;
+		std::memcpy(data + (position & mask), &wrap, sizeof(wrap));
+		position += contiguous;
+	}
+	pending = position + size;
+	return data + (position & mask);
+}
+
+inline void Log::BinaryLog::ThreadBuffer::commit() noexcept
+{
+	head.store(pending, std::memory_order_release);
+}
+
+template <typename... TArgs>
+void Log::BinaryLog::write(Logger &logger, const FormatSite &site, const TArgs &... args)
+{
+	size_t argBytes = encodedSize(args...);
+
+	if (_running.load(std::memory_order_relaxed)) {
+		// Pairs with stop(): either it sees this write in flight or we see it stopped
+		ThreadBuffer *buffer = _threadBuffer ? _threadBuffer : registerThread();
+		buffer->writing.store(true);
+		if (_running.load()) {
+			size_t size = (sizeof(EntryHeader) + argBytes + 7) & ~static_cast<size_t>(7);
+			char *out = buffer->reserve(size, _overflow.load(std::memory_order_relaxed));
+
+			if (out) {
+				EntryHeader header{static_cast<uint32_t>(size), static_cast<uint32_t>(argBytes), &site, &logger, CycleClock::now()};
+				std::memcpy(out, &header, sizeof(header));
+				encodeArgs(out + sizeof(header), args...);
+				buffer->commit();
+				if (!logger._deferred.load(std::memory_order_relaxed))
+					logger._deferred.store(true, std::memory_order_relaxed);
+			}
+			buffer->writing.store(false, std::memory_order_release);
+			return;
+		}
+		buffer->writing.store(false, std::memory_order_release);
+	}
+
+	std::vector<char> bytes(argBytes + 1);
+	encodeArgs(bytes.data(), args...);
+	writeInline(logger, site, bytes.data());
+}
+
+#endif
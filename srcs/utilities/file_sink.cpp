@@ -0,0 +1,358 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   file_sink.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:29:10 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 00:48:27 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/utilities/file_sink.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+constexpr size_t Log::FileSink::BufferCount;
+
+static int syncData(int fd)
+{
+#if defined(__linux__)
+	return ::fdatasync(fd);
+#else
+	return ::fsync(fd);
+#endif
+}
+
+/* Public Methods */
+
+Log::FileSink::FileSink(const std::string &path) : FileSink(path, Config())
+{
+}
+
+Log::FileSink::FileSink(const std::string &path, const Config &config)
+	: _path(path), _config(config), _level(LogLevel::DEBUG), _activeRecords(0), _dirty(false), _ioIdle(false), _stopping(false),
+	  _accepted(0), _syncTarget(0), _synced(0), _timestamps(), _fd(-1), _fileSize(0),
+	  _bytesWritten(0), _rotations(0), _writeErrors(0)
+{
+	if (_config.bufferSize == 0)
+		throw std::runtime_error("File sink buffer size must be positive");
+	if (_config.maxFiles == 0)
+		throw std::runtime_error("File sink must keep at least one rotated file");
+	if (_config.flushInterval.count() <= 0 || _config.fsyncInterval.count() <= 0)
+		throw std::runtime_error("File sink intervals must be positive");
+	if (!openFile())
+		throw std::runtime_error("Failed to open log file: " + _path + ": " + std::strerror(errno));
+
+	_active.reserve(_config.bufferSize);
+	for (size_t i = 1; i < BufferCount; ++i) {
+		_spare.emplace_back();
+		_spare.back().reserve(_config.bufferSize);
+	}
+	_lastFsync = std::chrono::steady_clock::now();
+	_thread = std::thread(&FileSink::ioRoutine, this);
+}
+
+/*
+** Writes everything still buffered, syncs it unless fsync is NEVER and
+** closes the file.
+*/
+Log::FileSink::~FileSink()
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_stopping = true;
+	}
+	_ioCondition.notify_one();
+	_thread.join();
+	if (_fd >= 0)
+		::close(_fd);
+}
+
+void Log::FileSink::write(const Record &record)
+{
+	if (record.level < _level.load(std::memory_order_relaxed))
+		return;
+
+	std::unique_lock<std::mutex> lock(_mutex);
+	size_t expected = record.message.size() + record.loggerName.size() + 96 + (record.source.file ? std::strlen(record.source.file) : 0);
+
+	while (!_active.empty() && _active.size() + expected > _config.bufferSize) {
+		if (!_spare.empty()) {
+			handOff();
+			break;
+		}
+		_ioCondition.notify_one();
+		_spaceCondition.wait(lock);
+	}
+	format(record);
+	++_activeRecords;
+	++_accepted;
+}
+
+// Marks the buffer for writing within flushInterval; never waits for I/O
+void Log::FileSink::flush()
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	if (_active.empty())
+		return;
+	_dirty = true;
+	if (_ioIdle) {
+		_ioIdle = false;
+		_ioCondition.notify_one();
+	}
+}
+
+void Log::FileSink::set_level(LogLevel level)
+{
+	_level.store(level, std::memory_order_relaxed);
+}
+
+/*
+** Blocks until every record accepted before the call is in the file, and
+** on disk unless fsync is NEVER.
+*/
+void Log::FileSink::sync()
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	uint64_t target = _accepted;
+
+	if (_synced >= target)
+		return;
+	_syncTarget = std::max(_syncTarget, target);
+	_ioCondition.notify_one();
+	_syncCondition.wait(lock, [&]() { return _synced >= target; });
+}
+
+const std::string &Log::FileSink::path() const noexcept
+{
+	return _path;
+}
+
+uint64_t Log::FileSink::bytesWritten() const noexcept
+{
+	return _bytesWritten.load(std::memory_order_relaxed);
+}
+
+uint64_t Log::FileSink::rotations() const noexcept
+{
+	return _rotations.load(std::memory_order_relaxed);
+}
+
+uint64_t Log::FileSink::writeErrors() const noexcept
+{
+	return _writeErrors.load(std::memory_order_relaxed);
+}
+
+/* Private Methods */
+
+// "YYYY-MM-DD HH:MM:SS.mmm [LEVEL] [logger] (file:line) - message"
+void Log::FileSink::format(const Record &record)
+{
+	char digits[16];
+
+	_timestamps.append(_active, record.timestamp);
+	_active.append(" [").append(levelName(record.level)).append("] [").append(record.loggerName).append("]");
+	if (record.source.file) {
+		char *end = std::to_chars(digits, digits + sizeof(digits), record.source.line).ptr;
+		_active.append(" (").append(record.source.file).append(1, ':').append(digits, end).append(1, ')');
+	}
+	_active.append(" - ").append(record.message).append(1, '\n');
+}
+
+// Queues the active buffer for the I/O thread and continues in a spare one
+void Log::FileSink::handOff()
+{
+	_full.push_back(std::move(_active));
+	_active = std::move(_spare.back());
+	_spare.pop_back();
+	_activeRecords = 0;
+	_ioCondition.notify_one();
+}
+
+bool Log::FileSink::openFile()
+{
+	struct stat status;
+
+	_fd = ::open(_path.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if (_fd < 0)
+		return false;
+	_fileSize = ::fstat(_fd, &status) == 0 ? static_cast<size_t>(status.st_size) : 0;
+	_openedAt = std::chrono::steady_clock::now();
+#if defined(FALLOC_FL_KEEP_SIZE)
+	// Reserve blocks up front without changing the visible size; failure only costs the optimization
+	if (_config.preallocate > _fileSize)
+		(void)::fallocate(_fd, FALLOC_FL_KEEP_SIZE, static_cast<off_t>(_fileSize), static_cast<off_t>(_config.preallocate - _fileSize));
+#endif
+	return true;
+}
+
+void Log::FileSink::rotate()
+{
+	if (_fd >= 0) {
+		if (_config.fsync != FsyncPolicy::NEVER)
+			syncData(_fd);
+		::close(_fd);
+		_fd = -1;
+	}
+	for (size_t i = _config.maxFiles; i > 1; --i)
+		std::rename((_path + "." + std::to_string(i - 1)).c_str(), (_path + "." + std::to_string(i)).c_str());
+	std::rename(_path.c_str(), (_path + ".1").c_str());
+	_rotations.fetch_add(1, std::memory_order_relaxed);
+	if (!openFile())
+		_writeErrors.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Rotation waits for a non-empty file, so a single large batch is never split
+bool Log::FileSink::rotationDue(size_t incoming) const
+{
+	if (_fileSize == 0)
+		return false;
+	if (_config.rotateSize && _fileSize + incoming > _config.rotateSize)
+		return true;
+	return _config.rotateInterval.count() > 0 && std::chrono::steady_clock::now() - _openedAt >= _config.rotateInterval;
+}
+
+bool Log::FileSink::fsyncDue(bool wrote, bool requested) const
+{
+	switch (_config.fsync) {
+		case FsyncPolicy::NEVER:
+			return false;
+		case FsyncPolicy::EVERY_WRITE:
+			return wrote || requested;
+		case FsyncPolicy::PERIODIC:
+			return requested || (wrote && std::chrono::steady_clock::now() - _lastFsync >= _config.fsyncInterval);
+	}
+	return false;
+}
+
+void Log::FileSink::writeBatch(std::vector<std::string> &batch)
+{
+	struct iovec iov[BufferCount + 1];
+	size_t count = 0;
+	size_t total = 0;
+
+	for (const std::string &buffer : batch) {
+		iov[count].iov_base = const_cast<char *>(buffer.data());
+		iov[count].iov_len = buffer.size();
+		total += buffer.size();
+		++count;
+	}
+	if (total == 0)
+		return;
+	if (_fd >= 0 && rotationDue(total))
+		rotate();
+	else if (_fd < 0)
+		openFile();
+	if (_fd < 0) {
+		_writeErrors.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	struct iovec *next = iov;
+	while (count > 0) {
+		ssize_t written = ::writev(_fd, next, static_cast<int>(count));
+
+		if (written < 0) {
+			if (errno == EINTR)
+				continue;
+			_writeErrors.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		_fileSize += static_cast<size_t>(written);
+		_bytesWritten.fetch_add(static_cast<uint64_t>(written), std::memory_order_relaxed);
+		size_t remaining = static_cast<size_t>(written);
+		while (count > 0 && remaining >= next->iov_len) {
+			remaining -= next->iov_len;
+			++next;
+			--count;
+		}
+		if (count > 0) {
+			next->iov_base = static_cast<char *>(next->iov_base) + remaining;
+			next->iov_len -= remaining;
+		}
+	}
+}
+
+/*
+** Sleeps until a buffer is full, a sync is requested or the sink stops;
+** a flushed buffer is picked up flushInterval later so that records
+** logged meanwhile share its write. Everything queued is written with
+** one writev.
+*/
+void Log::FileSink::ioRoutine()
+{
+	std::vector<std::string> batch;
+	std::unique_lock<std::mutex> lock(_mutex);
+
+	for (;;) {
+		auto ready = [this]() { return !_full.empty() || _stopping || _syncTarget > _synced; };
+
+		if (!ready()) {
+			if (!_dirty) {
+				_ioIdle = true;
+				_ioCondition.wait(lock, [&]() { return ready() || _dirty; });
+				_ioIdle = false;
+			}
+			_ioCondition.wait_for(lock, _config.flushInterval, ready);
+		}
+
+		bool requested = _syncTarget > _synced;
+		bool stopping = _stopping;
+		if (!_active.empty() && (_dirty || requested || stopping)) {
+			if (!_spare.empty()) {
+				handOff();
+			} else {
+				_full.push_back(std::move(_active));
+				_active = std::string();
+				_activeRecords = 0;
+			}
+		}
+		_dirty = false;
+		uint64_t covered = _accepted - _activeRecords;
+		while (!_full.empty() && batch.size() <= BufferCount) {
+			batch.push_back(std::move(_full.front()));
+			_full.pop_front();
+		}
+		bool complete = _full.empty();
+		lock.unlock();
+
+		writeBatch(batch);
+		// A failed sync (EINVAL on /dev/null, EIO) is counted, not retried:
+		// sync() callers would otherwise wait forever
+		bool synced = false;
+		if (fsyncDue(!batch.empty(), (requested || stopping) && complete) && _fd >= 0) {
+			if (syncData(_fd) != 0)
+				_writeErrors.fetch_add(1, std::memory_order_relaxed);
+			synced = true;
+			_lastFsync = std::chrono::steady_clock::now();
+		}
+
+		lock.lock();
+		for (std::string &buffer : batch) {
+			buffer.clear();
+			if (_active.capacity() == 0)
+				_active.swap(buffer);
+			else if (_spare.size() < BufferCount)
+				_spare.push_back(std::move(buffer));
+		}
+		batch.clear();
+		_spaceCondition.notify_all();
+		if (complete && (_config.fsync == FsyncPolicy::NEVER || synced || _fd < 0)) {
+			_synced = covered;
+			_syncCondition.notify_all();
+		}
+		if (stopping && complete)
+			break;
+	}
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_format.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:38:23 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:59:24 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/utilities/log_format.hpp"
+
+#include <charconv>
+
+void Log::Detail::appendValue(std::string &out, bool value)
+{
+	out.append(value ? "true" : "false");
+}
+
+void Log::Detail::appendValue(std::string &out, char value)
+{
+	out.push_back(value);
+}
+
+void Log::Detail::appendValue(std::string &out, int64_t value)
+{
+	char digits[24];
+
+	out.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+}
+
+void Log::Detail::appendValue(std::string &out, uint64_t value)
+{
+	char digits[24];
+
+	out.append(digits, std::to_chars(digits, digits + sizeof(digits), value).ptr);
+}
+
+// Shortest of fixed and scientific with 6 significant digits, like printf's %g
+void Log::Detail::appendValue(std::string &out, double value)
+{
+	char digits[32];
+
+	out.append(digits, std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::general, 6).ptr);
+}
+
+void Log::Detail::appendValue(std::string &out, std::string_view value)
+{
+	out.append(value.data(), value.size());
+}
+
+void Log::Detail::appendPointer(std::string &out, uintptr_t value)
+{
+	char digits[24];
+
+	out.append("0x").append(digits, std::to_chars(digits, digits + sizeof(digits), value, 16).ptr);
+}
+
+// A lone brace is kept as text
+bool Log::Detail::appendLiteral(std::string &out, std::string_view format, size_t &position)
+{
+	size_t literal = position;
+
+	for (size_t i = position; i + 1 < format.size(); ++i) {
+		char current = format[i];
+		char following = format[i + 1];
+		bool escaped = (current == '{' || current == '}') && following == current;
+
+		if (!escaped && !(current == '{' && following == '}'))
+			continue;
+		out.append(format.data() + literal, i - literal);
+		position = ++i + 1;
+		if (!escaped)
+			return true;
+		out.push_back(current);
+		literal = position;
+	}
+	out.append(format.data() + literal, format.size() - literal);
+	position = format.size();
+	return false;
+}
+
+template <typename TWire>
+static const char *readWire(const char *args, TWire &value)
+{
+	std::memcpy(&value, args, sizeof(value));
+	return args + sizeof(value);
+}
+
+static const char *renderArgument(std::string &out, Log::ArgType type, const char *args)
+{
+	switch (type) {
+		case Log::ArgType::BOOL: {
+			bool value;
+			args = readWire(args, value);
+			Log::Detail::appendValue(out, value);
+			return args;
+		}
+		case Log::ArgType::CHAR:
+			Log::Detail::appendValue(out, *args);
+			return args + 1;
+		case Log::ArgType::INT: {
+			int64_t value;
+			args = readWire(args, value);
+			Log::Detail::appendValue(out, value);
+			return args;
+		}
+		case Log::ArgType::UINT: {
+			uint64_t value;
+			args = readWire(args, value);
+			Log::Detail::appendValue(out, value);
+			return args;
+		}
+		case Log::ArgType::DOUBLE: {
+			double value;
+			args = readWire(args, value);
+			Log::Detail::appendValue(out, value);
+			return args;
+		}
+		case Log::ArgType::STRING: {
+			uint32_t length;
+			args = readWire(args, length);
+			Log::Detail::appendValue(out, std::string_view(args, length));
+			return args + length;
+		}
+		case Log::ArgType::POINTER: {
+			uintptr_t value;
+			args = readWire(args, value);
+			Log::Detail::appendPointer(out, value);
+			return args;
+		}
+	}
+	return args;
+}
+
+const char *Log::renderFormat(std::string &out, std::string_view format, const ArgType *types, size_t count, const char *args)
+{
+	size_t position = 0;
+
+	for (size_t next = 0; next < count && Detail::appendLiteral(out, format, position); ++next)
+		args = renderArgument(out, types[next], args);
+	while (Detail::appendLiteral(out, format, position))
+		out.append("{}");
+	return args;
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_format.tpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:38:23 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:59:24 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOG_FORMAT_TPP
+# define LOG_FORMAT_TPP
+
+namespace Log {
+
+	namespace Detail {
+
+		template <typename TType>
+		inline typename ArgTraitsOf<TType>::Wire toWire(const TType &value) noexcept
+		{
+			using Type = std::remove_cv_t<std::decay_t<TType>>;
+			using Wire = typename ArgTraitsOf<TType>::Wire;
+
+			if constexpr (std::is_same_v<Type, const char *> || std::is_same_v<Type, char *>) {
+				const char *text = value;
+				return text ? std::string_view(text) : std::string_view("(null)");
+			} else if constexpr (std::is_pointer_v<Type>)
+				return reinterpret_cast<Wire>(value);
+			else
+				return static_cast<Wire>(value);
+		}
+
+		template <typename TType>
+		inline size_t wireSize(const TType &value) noexcept
+		{
+			if constexpr (ArgTraitsOf<TType>::type == ArgType::STRING)
+				return sizeof(uint32_t) + toWire(value).size();
+			else
+				return sizeof(typename ArgTraitsOf<TType>::Wire);
+		}
+
+		// Strings are stored as a 32-bit length and their bytes, everything else as its wire type
+		template <typename TType>
+		inline char *encode(char *out, const TType &value) noexcept
+		{
+			auto wire = toWire(value);
+
+			if constexpr (ArgTraitsOf<TType>::type == ArgType::STRING) {
+				uint32_t length = static_cast<uint32_t>(wire.size());
+				std::memcpy(out, &length, sizeof(length));
+				std::memcpy(out + sizeof(length), wire.data(), length);
+				return out + sizeof(length) + length;
+			} else {
+				std::memcpy(out, &wire, sizeof(wire));
+				return out + sizeof(wire);
+			}
+		}
+
+	}
+
+	namespace Detail {
+
+		template <typename TType>
+		inline void appendArgument(std::string &out, const TType &value)
+		{
+			if constexpr (ArgTraitsOf<TType>::type == ArgType::POINTER)
+				appendPointer(out, toWire(value));
+			else
+				appendValue(out, toWire(value));
+		}
+
+	}
+
+	template <typename... TArgs>
+	void formatTo(std::string &out, std::string_view format, const TArgs &... args)
+	{
+		size_t position = 0;
+
+		((Detail::appendLiteral(out, format, position) ? Detail::appendArgument(out, args) : void()), ...);
+		while (Detail::appendLiteral(out, format, position))
+			out.append("{}");
+	}
+
+	template <typename... TArgs>
+	size_t encodedSize(const TArgs &... args) noexcept
+	{
+		return (size_t(0) + ... + Detail::wireSize(args));
+	}
+
+	template <typename... TArgs>
+	char *encodeArgs(char *out, const TArgs &... args) noexcept
+	{
+		((out = Detail::encode(out, args)), ...);
+		return out;
+	}
+
+}
+
+#endif
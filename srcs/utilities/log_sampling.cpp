@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   log_sampling.cpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:11:39 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 00:11:39 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../inc/utilities/log_sampling.hpp"
+
+#include <chrono>
+#include <time.h>
+
+/*
+** The high half of the state is the window number plus one (zero before
+** the first call), the low half the calls seen in that window, saturated.
+*/
+Log::Admission Log::RateLimiter::admit(uint64_t perSecond) noexcept
+{
+	const uint64_t countMask = 0xffffffffu;
+	uint64_t window = (currentWindow() + 1) & countMask;
+	uint64_t current = _state.load(std::memory_order_relaxed);
+
+	for (;;) {
+		uint64_t seen = current >> 32;
+		uint64_t count = current & countMask;
+
+		if (seen == window) {
+			if (count == countMask)
+				return Admission{false, 0};
+			if (_state.compare_exchange_weak(current, current + 1, std::memory_order_relaxed))
+				return Admission{count < perSecond, 0};
+		} else if (_state.compare_exchange_weak(current, (window << 32) | 1, std::memory_order_relaxed)) {
+			return Admission{perSecond > 0, seen && count > perSecond ? count - perSecond : 0};
+		}
+	}
+}
+
+// The coarse clock is read from the vDSO without a syscall; a few ms of resolution is plenty here
+uint64_t Log::RateLimiter::currentWindow() noexcept
+{
+#if defined(CLOCK_MONOTONIC_COARSE)
+	struct timespec now;
+
+	if (clock_gettime(CLOCK_MONOTONIC_COARSE, &now) == 0)
+		return static_cast<uint64_t>(now.tv_sec);
+#endif
+	return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+		std::chrono::steady_clock::now().time_since_epoch()).count());
+}
@@ -6,25 +6,103 @@
 /*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/08/14 12:52:07 by lagea             #+#    #+#             */
-/*   Updated: 2025/08/14 15:53:09 by lagea            ###   ########.fr       */
+/*   Updated: 2026/10/18 02:58:50 by lagea            ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../inc/utilities/logger.hpp"
+#include "../../inc/utilities/binary_log.hpp"
+#include "../../inc/threading/bounded_mpmc_queue.hpp"
+#include "../../inc/time/cycle_clock.hpp"
 
-Log::Logger::Logger(const std::string &name) : _name(name), _logLevel(LogLevel::CRITICAL), _sinks()
+#include <condition_variable>
+#include <stdexcept>
+
+/*
+** Producers stamp records with CycleClock ticks, a fraction of the cost of
+** system_clock::now(); the sink thread turns them into wall-clock time
+** against a CycleClock::WallAnchor it takes once per batch.
+*/
+struct QueuedRecord
+{
+	Log::Record record;
+	uint64_t ticks = 0;
+};
+
+struct Log::Logger::AsyncState
+{
+	explicit AsyncState(const AsyncConfig &config) : config(config), queue(config.capacity) {}
+
+	AsyncConfig config;
+	BoundedMPMCQueue<QueuedRecord> queue;
+	std::atomic<uint64_t> dropped{0};
+	std::atomic<uint64_t> delivered{0};
+	std::atomic<bool> sleeping{false};
+	std::atomic<bool> stopping{false};
+	std::atomic<size_t> writers{0};
+	std::mutex wakeMutex;
+	std::condition_variable wakeCondition;
+	std::mutex flushMutex;
+	std::condition_variable flushCondition;
+	size_t wakeThreshold = 1;
+	bool flushRequested = false;
+	std::thread thread;
+
+	static constexpr std::chrono::milliseconds IdleWait{1};
+};
+
+static void wakeSinkThread(std::mutex &mutex, std::condition_variable &condition, bool *flag = nullptr)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if (flag)
+			*flag = true;
+	}
+	condition.notify_one();
+}
+
+const char *Log::levelName(LogLevel level) noexcept
+{
+	switch (level) {
+		case LogLevel::DEBUG: return "DEBUG";
+		case LogLevel::TRACE: return "TRACE";
+		case LogLevel::INFO: return "INFO";
+		case LogLevel::WARNING: return "WARNING";
+		case LogLevel::ERROR: return "ERROR";
+		case LogLevel::CRITICAL: return "CRITICAL";
+	}
+	return "UNKNOWN";
+}
+
+Log::Logger::Logger(const std::string &name) : _name(name), _logLevel(LogLevel::CRITICAL), _sinks(), _asyncState(nullptr), _deferred(false)
 {
 }
 
-Log::Logger::Logger(Logger &&other) noexcept : _name(std::move(other._name)), _logLevel(other._logLevel), _sinks(std::move(other._sinks))
+/*
+** The sink thread works on the moved-from logger, so moving stops async
+** mode on the source; the new logger starts synchronous. Deferred entries
+** queued for the source are delivered before its sinks move. Not
+** noexcept: stopping joins the sink thread and draining runs the sinks.
+*/
+Log::Logger::Logger(Logger &&other) : _asyncState(nullptr), _deferred(false)
 {
+	other.stopAsync();
+	if (other._deferred.load(std::memory_order_relaxed))
+		BinaryLog::flush();
+	_name = std::move(other._name);
+	_logLevel.store(other._logLevel.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	_sinks = std::move(other._sinks);
 }
 
-Log::Logger &Log::Logger::operator=(Logger &&other) noexcept
+Log::Logger &Log::Logger::operator=(Logger &&other)
 {
 	if (this != &other) {
+		stopAsync();
+		other.stopAsync();
+		if (_deferred.load(std::memory_order_relaxed) || other._deferred.load(std::memory_order_relaxed))
+			BinaryLog::flush();
 		_name = std::move(other._name);
-		_logLevel = other._logLevel;
+		_logLevel.store(other._logLevel.load(std::memory_order_relaxed), std::memory_order_relaxed);
 		_sinks = std::move(other._sinks);
 	}
 	return *this;
@@ -32,11 +110,14 @@ Log::Logger &Log::Logger::operator=(Logger &&other) noexcept
 
 Log::Logger::~Logger()
 {
+	stopAsync();
+	if (_deferred.load(std::memory_order_relaxed))
+		BinaryLog::release(this);
 }
 
 void Log::Logger::setName(const std::string &name)
 {
-	std::lock_guard<std::mutex> lock(_mutex);
+	std::scoped_lock lock(_mutex, _sinkMutex);
 
 	_name = name;
 }
@@ -50,7 +131,7 @@ const std::string Log::Logger::getName() const
 
 void Log::Logger::addSink(Sink *sink)
 {
-	std::lock_guard<std::mutex> lock(_mutex);
+	std::scoped_lock lock(_mutex, _sinkMutex);
 
 	if (sink)
 		_sinks.push_back(sink);
@@ -58,7 +139,7 @@ void Log::Logger::addSink(Sink *sink)
 
 void Log::Logger::removeSink(Sink *sink)
 {
-	std::lock_guard<std::mutex> lock(_mutex);
+	std::scoped_lock lock(_mutex, _sinkMutex);
 
 	if (sink) {
 		auto it = std::remove_if(_sinks.begin(), _sinks.end(), [sink](const Sink *s) { return s == sink; });
@@ -69,22 +150,15 @@ void Log::Logger::removeSink(Sink *sink)
 
 void Log::Logger::clearSinks()
 {
-	std::lock_guard<std::mutex> lock(_mutex);
+	std::scoped_lock lock(_mutex, _sinkMutex);
 
 	_sinks.clear();
 }
 
+// Lock-free so that filtered statements never touch the mutex
 void Log::Logger::setLogLevel(LogLevel level)
 {
-	std::lock_guard<std::mutex> lock(_mutex);
-	
-	_logLevel = level;
-}
-
-bool Log::Logger::shoudLog(LogLevel level) const
-{
-	std::lock_guard<std::mutex> lock(_mutex);
-	return _logLevel <= level;
+	_logLevel.store(level, std::memory_order_relaxed);
 }
 
 void Log::Logger::log(LogLevel level, const std::string &message, const Source &source)
@@ -92,16 +166,61 @@ void Log::Logger::log(LogLevel level, const std::string &message, const Source &
 	if (!shoudLog(level))
 		return;
 
-	std::lock_guard<std::mutex> lock(_mutex);
+	if (AsyncState *state = _asyncState.load(std::memory_order_acquire)) {
+		/*
+		** Counted before the state is checked again, both seq_cst: either
+		** stopAsync() sees this writer and waits for its push, or we see
+		** the switch and log synchronously below.
+		*/
+		struct Writer
+		{
+			explicit Writer(std::atomic<size_t> &count) : count(count) { count.fetch_add(1); }
+			~Writer() { count.fetch_sub(1, std::memory_order_release); }
+			std::atomic<size_t> &count;
+		};
+		Writer writer(state->writers);
+		if (_asyncState.load() == state) {
+			push(*state, level, message, source);
+			return;
+		}
+	}
+
+	/*
+	** The record is reused per thread so that its strings keep their
+	** capacity; a sink that logs from write() gets a fresh one.
+	*/
+	struct Claim
+	{
+		explicit Claim(bool &flag) : busy(flag), owned(!flag) { flag = true; }
+		~Claim() { if (owned) busy = false; }
+		bool &busy;
+		bool owned;
+	};
+	thread_local Record reusable;
+	thread_local bool busy = false;
+	Claim claim(busy);
+	Record fresh;
+	Record &record = claim.owned ? reusable : fresh;
 
-	Record record;
 	record.timestamp = std::chrono::system_clock::now();
 	record.level = level;
-	record.message = message;
-	record.loggerName = _name;
+	record.message.assign(message);
 	record.source = source;
 	record.threadId = std::this_thread::get_id();
-	
+	dispatch(record);
+}
+
+/*
+** Hands a finished record to every sink on the calling thread, in any
+** mode; the logger fills in its name. Used by backends that build records
+** themselves.
+*/
+void Log::Logger::dispatch(Record &record)
+{
+	// Name and sinks only change under both locks, so the sink lock is enough to read them
+	std::lock_guard<std::mutex> lock(_sinkMutex);
+
+	record.loggerName = _name;
 	for (const auto &sink : _sinks) {
 		if (sink)
 			sink->write(record);
@@ -111,3 +230,218 @@ void Log::Logger::log(LogLevel level, const std::string &message, const Source &
 			sink->flush();
 	}
 }
+
+/*
+** A ring with the same capacity is reused across stop/start. States are
+** never freed before the logger, so a caller that loaded the state just
+** before stopAsync() still pushes into valid memory.
+*/
+void Log::Logger::startAsync(const AsyncConfig &config)
+{
+	if (config.batchSize == 0)
+		throw std::runtime_error("Async batch size must be positive");
+
+	stopAsync();
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	AsyncState *state = nullptr;
+	if (!_asyncStates.empty() && _asyncStates.back()->config.capacity == config.capacity) {
+		state = _asyncStates.back().get();
+		state->config = config;
+	} else {
+		_asyncStates.push_back(std::make_unique<AsyncState>(config));
+		state = _asyncStates.back().get();
+	}
+	state->wakeThreshold = std::min(config.batchSize, state->queue.capacity() / 2);
+	state->stopping.store(false);
+	state->thread = std::thread(&Logger::sinkRoutine, this, std::ref(*state));
+	_asyncState.store(state, std::memory_order_release);
+}
+
+/*
+** Delivers everything queued, then joins the sink thread. Callers that
+** were already pushing when the state was switched off are waited for
+** while the sink thread still runs, so their records are delivered too.
+*/
+void Log::Logger::stopAsync()
+{
+	AsyncState *state = _asyncState.exchange(nullptr);
+
+	if (!state)
+		return;
+	while (state->writers.load(std::memory_order_acquire))
+		std::this_thread::yield();
+	{
+		std::lock_guard<std::mutex> lock(state->wakeMutex);
+		state->stopping.store(true);
+	}
+	state->wakeCondition.notify_one();
+	state->thread.join();
+	drainInline(*state);
+}
+
+bool Log::Logger::isAsync() const noexcept
+{
+	return _asyncState.load(std::memory_order_acquire) != nullptr;
+}
+
+/*
+** In async mode, waits until every record queued before the call has been
+** written and its sinks flushed.
+*/
+void Log::Logger::flush()
+{
+	AsyncState *state = _asyncState.load(std::memory_order_acquire);
+
+	if (!state) {
+		std::scoped_lock lock(_mutex, _sinkMutex);
+		for (const auto &sink : _sinks) {
+			if (sink)
+				sink->flush();
+		}
+		return;
+	}
+
+	uint64_t target = state->queue.pushed();
+	wakeSinkThread(state->wakeMutex, state->wakeCondition, &state->flushRequested);
+	std::unique_lock<std::mutex> lock(state->flushMutex);
+	state->flushCondition.wait(lock, [&]() { return state->delivered.load() >= target; });
+}
+
+// Total over every async session of this logger
+uint64_t Log::Logger::droppedRecords() const
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	uint64_t dropped = 0;
+
+	for (const auto &state : _asyncStates)
+		dropped += state->dropped.load(std::memory_order_relaxed);
+	return dropped;
+}
+
+/* Private Methods */
+
+/*
+** The slot's strings keep their capacity between laps, so once the ring
+** has warmed up a push copies the message without allocating.
+*/
+void Log::Logger::push(AsyncState &state, LogLevel level, const std::string &message, const Source &source)
+{
+	uint64_t ticks = CycleClock::now();
+	std::thread::id threadId = std::this_thread::get_id();
+	auto fill = [&](QueuedRecord &slot) {
+		slot.ticks = ticks;
+		slot.record.level = level;
+		slot.record.message.assign(message);
+		slot.record.source = source;
+		slot.record.threadId = threadId;
+	};
+
+	for (unsigned attempt = 0; !state.queue.tryPushWith(fill); ++attempt) {
+		switch (state.config.overflow) {
+			case OverflowPolicy::DROP_NEWEST:
+				state.dropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			case OverflowPolicy::DROP_OLDEST:
+				if (state.queue.tryPopWith([](QueuedRecord &) {}))
+					state.dropped.fetch_add(1, std::memory_order_relaxed);
+				break;
+			case OverflowPolicy::BLOCK:
+				wakeSinkThread(state.wakeMutex, state.wakeCondition);
+				if (attempt < 64)
+					std::this_thread::yield();
+				else
+					std::this_thread::sleep_for(std::chrono::microseconds(50));
+				break;
+		}
+	}
+	// A sleeping sink thread wakes on its own within IdleWait; only a full batch is worth a syscall here
+	if (state.sleeping.load(std::memory_order_relaxed) && state.queue.sizeApprox() >= state.wakeThreshold)
+		wakeSinkThread(state.wakeMutex, state.wakeCondition);
+}
+
+/*
+** Every sink sees the records in order; each sink is flushed once per
+** batch instead of once per record.
+*/
+void Log::Logger::deliver(std::vector<Record> &batch, size_t count)
+{
+	std::lock_guard<std::mutex> lock(_sinkMutex);
+
+	for (size_t i = 0; i < count; ++i) {
+		batch[i].loggerName.assign(_name);
+		for (const auto &sink : _sinks) {
+			if (sink)
+				sink->write(batch[i]);
+		}
+	}
+	for (const auto &sink : _sinks) {
+		if (sink)
+			sink->flush();
+	}
+}
+
+// Copied rather than swapped, so each slot keeps the capacity it has grown to
+static size_t popBatch(BoundedMPMCQueue<QueuedRecord> &queue, std::vector<Log::Record> &batch)
+{
+	CycleClock::WallAnchor anchor;
+	size_t count = 0;
+
+	while (count < batch.size() && queue.tryPopWith([&](QueuedRecord &slot) {
+		Log::Record &record = batch[count];
+		record.timestamp = anchor.toWallClock(slot.ticks);
+		record.level = slot.record.level;
+		record.message.assign(slot.record.message);
+		record.source = slot.record.source;
+		record.threadId = slot.record.threadId;
+	}))
+		++count;
+	return count;
+}
+
+static void publishDelivered(std::atomic<uint64_t> &delivered, uint64_t position, std::mutex &mutex, std::condition_variable &condition)
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		delivered.store(position);
+	}
+	condition.notify_all();
+}
+
+void Log::Logger::sinkRoutine(AsyncState &state)
+{
+	std::vector<Record> batch(state.config.batchSize);
+
+	for (;;) {
+		size_t count = popBatch(state.queue, batch);
+		if (count) {
+			deliver(batch, count);
+			publishDelivered(state.delivered, state.queue.popped(), state.flushMutex, state.flushCondition);
+			continue;
+		}
+		publishDelivered(state.delivered, state.queue.popped(), state.flushMutex, state.flushCondition);
+
+		std::unique_lock<std::mutex> lock(state.wakeMutex);
+		if (state.stopping.load())
+			return;
+		state.sleeping.store(true, std::memory_order_relaxed);
+		state.wakeCondition.wait_for(lock, AsyncState::IdleWait, [&]() {
+			return state.queue.sizeApprox() >= state.wakeThreshold || state.stopping.load() || state.flushRequested;
+		});
+		state.sleeping.store(false, std::memory_order_relaxed);
+		state.flushRequested = false;
+	}
+}
+
+void Log::Logger::drainInline(AsyncState &state)
+{
+	std::vector<Record> batch(state.config.batchSize);
+	size_t count;
+
+	do {
+		count = popBatch(state.queue, batch);
+		if (count)
+			deliver(batch, count);
+	} while (count);
+	publishDelivered(state.delivered, state.queue.popped(), state.flushMutex, state.flushCondition);
+}
@@ -0,0 +1,33 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   logger.tpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: lagea < lagea@student.s19.be >             +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:55:05 by lagea             #+#    #+#             */
+/*   Updated: 2026/10/18 23:55:05 by lagea            ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LOGGER_TPP
+# define LOGGER_TPP
+
+/*
+** The buffer is per thread and keeps its capacity, so formatting stops
+** allocating once it has held the longest message. log() copies the text
+** out before any sink runs, which lets a sink log again on this thread.
+*/
+template <typename... TArgs>
+void Log::Logger::logFormat(LogLevel level, const Source &source, std::string_view format, const TArgs &... args)
+{
+	thread_local std::string message;
+
+	if (!shoudLog(level))
+		return;
+	message.clear();
+	formatTo(message, format, args...);
+	log(level, message, source);
+}
+
+#endif
@@ -0,0 +1,269 @@
+#include "../libftpp.hpp"
+#include <iostream>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <unistd.h>
+
+class RecordingSink : public Log::Sink {
+private:
+	std::mutex _mutex;
+	std::vector<Log::Record> _records;
+	std::chrono::microseconds _delay;
+
+public:
+	explicit RecordingSink(std::chrono::microseconds delay = std::chrono::microseconds(0)) : _delay(delay) {}
+
+	void write(const Log::Record &record) override {
+		if (_delay.count())
+			std::this_thread::sleep_for(_delay);
+		std::lock_guard<std::mutex> lock(_mutex);
+		_records.push_back(record);
+	}
+	void flush() override {}
+	void set_level(Log::LogLevel) override {}
+
+	std::vector<Log::Record> records() {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _records;
+	}
+};
+
+enum class Color { RED = 2 };
+
+static const char *yesNo(bool value) {
+	return value ? "yes" : "no";
+}
+
+void test_formatting() {
+	std::cout << "=== Formatting Test ===" << std::endl;
+	Log::Logger logger("BinTest");
+	RecordingSink sink;
+	logger.addSink(&sink);
+	logger.setLogLevel(Log::LogLevel::DEBUG);
+
+	std::string name = "alice";
+	std::string_view view = "view";
+	const char *missing = nullptr;
+	LOG_BIN_INFO(logger, "user {} took {} ms", 42, 3.5);
+	LOG_BIN_INFO(logger, "{} {} {} {} {} {} {}", true, 'x', -7, 18446744073709551615ull, name, view, missing);
+	LOG_BIN_INFO(logger, "{{literal}} {} {}", Color::RED, 1.0 / 3);
+	LOG_BIN_WARNING(logger, "no arguments");
+
+	std::vector<Log::Record> records = sink.records();
+	std::cout << "Numbers: " << yesNo(records.size() == 4 && records[0].message == "user 42 took 3.5 ms") << std::endl;
+	std::cout << "Bool, char, strings: " << yesNo(records.size() == 4 && records[1].message == "true x -7 18446744073709551615 alice view (null)") << std::endl;
+	std::cout << "Escapes and enums: " << yesNo(records.size() == 4 && records[2].message == "{literal} 2 0.333333") << std::endl;
+	std::cout << "Level and source kept: " << yesNo(records.size() == 4 && records[3].level == Log::LogLevel::WARNING
+											&& std::string(records[3].source.function) == "test_formatting") << std::endl;
+	std::cout << "Compile-time placeholder count: " << yesNo(Log::placeholderCount("a {} b {{}} {}") == 2
+													&& Log::placeholderCount("broken {") == Log::BadFormat) << std::endl;
+	std::cout << std::endl;
+}
+
+void test_background(bool block) {
+	std::cout << "=== Background Thread Test (" << (block ? "BLOCK" : "DROP_NEWEST") << ") ===" << std::endl;
+	Log::Logger logger("BinTest");
+	RecordingSink sink;
+	logger.addSink(&sink);
+	logger.setLogLevel(Log::LogLevel::INFO);
+
+	Log::BinaryLog::Config config;
+	config.overflow = block ? Log::OverflowPolicy::BLOCK : Log::OverflowPolicy::DROP_NEWEST;
+	Log::BinaryLog::start(config);
+	uint64_t droppedBefore = Log::BinaryLog::droppedEntries();
+
+	const int threadCount = 4;
+	const int perThread = 5000;
+	std::vector<std::thread> threads;
+	std::vector<std::thread::id> ids(threadCount);
+	auto before = std::chrono::system_clock::now();
+	for (int t = 0; t < threadCount; ++t) {
+		threads.emplace_back([&logger, &ids, t]() {
+			ids[t] = std::this_thread::get_id();
+			for (int i = 0; i < perThread; ++i) {
+				LOG_BIN_INFO(logger, "{} {}", t, i);
+				LOG_BIN_DEBUG(logger, "filtered {}", i);
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	Log::BinaryLog::flush();
+	auto after = std::chrono::system_clock::now();
+
+	std::vector<Log::Record> records = sink.records();
+	std::vector<int> next(threadCount, 0);
+	bool ordered = true, threadsKept = true, timely = true;
+	for (const Log::Record &record : records) {
+		int t = std::stoi(record.message.substr(0, record.message.find(' ')));
+		int i = std::stoi(record.message.substr(record.message.find(' ') + 1));
+		if (i < next[t])
+			ordered = false;
+		next[t] = i + 1;
+		threadsKept = threadsKept && record.threadId == ids[t];
+		timely = timely && record.timestamp >= before - std::chrono::milliseconds(5) && record.timestamp <= after + std::chrono::milliseconds(5);
+	}
+	uint64_t dropped = Log::BinaryLog::droppedEntries() - droppedBefore;
+	std::cout << "Every entry delivered or counted: " << yesNo(records.size() + dropped == threadCount * perThread) << std::endl;
+	if (block)
+		std::cout << "Nothing dropped: " << yesNo(dropped == 0) << std::endl;
+	std::cout << "Per-thread order kept: " << yesNo(ordered) << std::endl;
+	std::cout << "Thread ids kept: " << yesNo(threadsKept) << std::endl;
+	std::cout << "Timestamps from the call: " << yesNo(timely) << std::endl;
+	Log::BinaryLog::stop();
+	std::cout << std::endl;
+}
+
+void test_overflow() {
+	std::cout << "=== Overflow Test ===" << std::endl;
+	Log::Logger logger("BinTest");
+	RecordingSink sink(std::chrono::microseconds(50));
+	logger.addSink(&sink);
+	logger.setLogLevel(Log::LogLevel::INFO);
+
+	Log::BinaryLog::Config config;
+	config.bufferSize = 4096;
+	Log::BinaryLog::start(config);
+	uint64_t droppedBefore = Log::BinaryLog::droppedEntries();
+	std::thread producer([&logger]() {
+		for (int i = 0; i < 2000; ++i)
+			LOG_BIN_INFO(logger, "entry {}", i);
+	});
+	producer.join();
+	Log::BinaryLog::flush();
+	uint64_t dropped = Log::BinaryLog::droppedEntries() - droppedBefore;
+	std::cout << "Full ring drops: " << yesNo(dropped > 0) << std::endl;
+	std::cout << "Delivered plus dropped: " << yesNo(sink.records().size() + dropped == 2000) << std::endl;
+	Log::BinaryLog::stop();
+	std::cout << std::endl;
+}
+
+void test_logger_lifetime() {
+	std::cout << "=== Logger Lifetime Test ===" << std::endl;
+	RecordingSink sink(std::chrono::microseconds(20));
+	Log::BinaryLog::start();
+	{
+		Log::Logger logger("ShortLived");
+		logger.addSink(&sink);
+		logger.setLogLevel(Log::LogLevel::INFO);
+		for (int i = 0; i < 500; ++i)
+			LOG_BIN_INFO(logger, "entry {}", i);
+	}
+	std::cout << "Pending entries delivered before destruction: " << yesNo(sink.records().size() == 500) << std::endl;
+	Log::BinaryLog::stop();
+
+	Log::Logger logger("Stopped");
+	logger.addSink(&sink);
+	logger.setLogLevel(Log::LogLevel::INFO);
+	LOG_BIN_INFO(logger, "inline {}", 1);
+	std::cout << "Stopped backend logs inline: " << yesNo(!Log::BinaryLog::isRunning() && sink.records().back().message == "inline 1") << std::endl;
+	std::cout << std::endl;
+}
+
+class CountingSink : public Log::Sink {
+public:
+	std::atomic<size_t> count{0};
+
+	void write(const Log::Record &) override { count.fetch_add(1); }
+	void flush() override {}
+	void set_level(Log::LogLevel) override {}
+};
+
+void test_stop_race() {
+	std::cout << "=== Stop While Writing Test ===" << std::endl;
+	Log::BinaryLog::Config config;
+	config.overflow = Log::OverflowPolicy::BLOCK;
+	const int threadCount = 4;
+	const int perThread = 2000;
+	bool complete = true;
+
+	// Entries are either drained by stop() or logged inline, so every one
+	// has reached the sink by the time the writers are joined
+	for (int round = 0; round < 200 && complete; ++round) {
+		CountingSink sink;
+		Log::Logger logger("Racing");
+		logger.addSink(&sink);
+		logger.setLogLevel(Log::LogLevel::INFO);
+		std::vector<std::thread> writers;
+
+		Log::BinaryLog::start(config);
+		for (int t = 0; t < threadCount; ++t) {
+			writers.emplace_back([&logger]() {
+				for (int i = 0; i < perThread; ++i)
+					LOG_BIN_INFO(logger, "entry {}", i);
+			});
+		}
+		std::this_thread::sleep_for(std::chrono::microseconds(round * 10));
+		Log::BinaryLog::stop();
+		for (auto &writer : writers)
+			writer.join();
+		complete = sink.count.load() == static_cast<size_t>(threadCount * perThread);
+	}
+	std::cout << "No entry left behind by stop(): " << yesNo(complete) << std::endl;
+	std::cout << std::endl;
+}
+
+void test_file_mode() {
+	std::cout << "=== File Mode Test ===" << std::endl;
+	char path[] = "/tmp/libftpp_binary_log_XXXXXX";
+	int fd = mkstemp(path);
+	if (fd >= 0)
+		close(fd);
+
+	Log::Logger logger("FileBin");
+	RecordingSink sink;
+	logger.addSink(&sink);
+	logger.setLogLevel(Log::LogLevel::INFO);
+
+	Log::BinaryLog::Config config;
+	config.path = path;
+	for (int session = 0; session < 2; ++session) {
+		Log::BinaryLog::start(config);
+		for (int i = 0; i < 1000; ++i)
+			LOG_BIN_INFO(logger, "session {} entry {} {}", session, i, std::string("text"));
+		LOG_BIN_ERROR(logger, "done {}", session);
+		Log::BinaryLog::stop();
+	}
+
+	std::ifstream in(path, std::ios::binary);
+	std::ostringstream out;
+	Log::BinaryLog::decode(in, out);
+	std::vector<std::string> lines;
+	std::istringstream text(out.str());
+	for (std::string line; std::getline(text, line);)
+		lines.push_back(line);
+
+	bool ordered = lines.size() == 2002;
+	for (int session = 0; ordered && session < 2; ++session) {
+		for (int i = 0; ordered && i < 1000; ++i) {
+			const std::string &line = lines[session * 1001 + i];
+			ordered = line.substr(line.find(" - ") + 3) == "session " + std::to_string(session) + " entry " + std::to_string(i) + " text";
+		}
+	}
+	std::cout << "Sinks bypassed: " << yesNo(sink.records().empty()) << std::endl;
+	std::cout << "Both sessions decoded in order: " << yesNo(ordered) << std::endl;
+	std::cout << "Decoded line format: " << yesNo(!lines.empty() && lines[1000].find(" [ERROR] [FileBin] (") == 23
+											&& lines[1000].substr(lines[1000].size() - 6) == "done 0") << std::endl;
+	std::remove(path);
+	std::cout << std::endl;
+}
+
+int main() {
+	test_formatting();
+	test_background(true);
+	test_background(false);
+	test_overflow();
+	test_logger_lifetime();
+	test_stop_race();
+	test_file_mode();
+	std::cout << "=== All BinaryLog Tests Completed ===" << std::endl;
+	return 0;
+}
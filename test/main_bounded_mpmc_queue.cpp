@@ -0,0 +1,115 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <string>
+#include "../libftpp.hpp"
+
+void test_fifo_and_bounds() {
+	std::cout << "\n=== FIFO And Bounds Test ===" << std::endl;
+
+	BoundedMPMCQueue<int> queue(5);
+	std::cout << "Capacity rounded to: " << queue.capacity() << std::endl;
+
+	int pushed = 0;
+	while (queue.tryPush(pushed))
+		++pushed;
+	std::cout << "Pushed until full: " << pushed << std::endl;
+
+	bool ordered = true;
+	int value;
+	for (int i = 0; i < pushed; ++i)
+		ordered = queue.tryPop(value) && value == i && ordered;
+	std::cout << "Popped in order: " << (ordered ? "yes" : "no") << std::endl;
+	std::cout << "Empty pop fails: " << (!queue.tryPop(value) ? "yes" : "no") << std::endl;
+
+	bool threw = false;
+	try {
+		BoundedMPMCQueue<int> tiny(1);
+	} catch (const std::runtime_error &) {
+		threw = true;
+	}
+	std::cout << "Capacity below 2 rejected: " << (threw ? "yes" : "no") << std::endl;
+}
+
+void test_slot_reuse() {
+	std::cout << "\n=== Slot Reuse Test ===" << std::endl;
+
+	BoundedMPMCQueue<std::string> queue(4);
+	std::string taken;
+	std::string message(200, 'x');
+
+	// Swap the consumer's string into the slot so capacity circulates
+	for (int lap = 0; lap < 8; ++lap) {
+		queue.tryPushWith([&](std::string &slot) { slot.assign(message); });
+		queue.tryPopWith([&](std::string &slot) { std::swap(taken, slot); });
+	}
+	bool stable = true;
+	for (int lap = 0; lap < 8; ++lap) {
+		queue.tryPushWith([&](std::string &slot) {
+			if (lap >= 4 && slot.capacity() < message.size())
+				stable = false;
+			slot.assign(message);
+		});
+		queue.tryPopWith([&](std::string &slot) { std::swap(taken, slot); });
+	}
+	std::cout << "Slots keep their capacity: " << (stable ? "yes" : "no") << std::endl;
+	std::cout << "Value intact: " << (taken == message ? "yes" : "no") << std::endl;
+}
+
+void test_concurrent() {
+	std::cout << "\n=== Concurrent Producers/Consumers Test ===" << std::endl;
+
+	const int producers = 4;
+	const int consumers = 4;
+	const int perProducer = 100000;
+	BoundedMPMCQueue<int> queue(1024);
+	std::vector<std::atomic<int>> seen(producers * perProducer);
+	std::atomic<int> consumed{0};
+	std::vector<std::thread> threads;
+
+	for (auto &s : seen)
+		s.store(0);
+	for (int p = 0; p < producers; ++p) {
+		threads.emplace_back([&, p]() {
+			for (int i = 0; i < perProducer; ++i) {
+				while (!queue.tryPush(p * perProducer + i))
+					std::this_thread::yield();
+			}
+		});
+	}
+	for (int c = 0; c < consumers; ++c) {
+		threads.emplace_back([&]() {
+			int value;
+			while (consumed.load() < producers * perProducer) {
+				if (queue.tryPop(value)) {
+					seen[value].fetch_add(1);
+					consumed.fetch_add(1);
+				} else {
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+
+	int missing = 0;
+	int duplicates = 0;
+	for (auto &s : seen) {
+		if (s.load() == 0)
+			missing++;
+		else if (s.load() > 1)
+			duplicates++;
+	}
+	std::cout << "Consumed: " << consumed.load() << std::endl;
+	std::cout << "Missing: " << missing << ", duplicates: " << duplicates << std::endl;
+}
+
+int main() {
+	test_fifo_and_bounds();
+	test_slot_reuse();
+	test_concurrent();
+
+	return 0;
+}
@@ -0,0 +1,142 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <string>
+#include "../libftpp.hpp"
+
+void test_priority_order() {
+	std::cout << "\n=== Priority Order Test ===" << std::endl;
+
+	ConcurrentPriorityQueue<std::string> queue(1);
+
+	queue.push(1, "bulk csv row");
+	queue.push(10, "urgent network message");
+	queue.push(5, "state machine update");
+	queue.push(10, "second urgent message");
+
+	std::string value;
+	while (queue.tryPop(value))
+		std::cout << "Popped: " << value << std::endl;
+
+	std::cout << "Queue empty: " << std::boolalpha << queue.empty() << std::endl;
+}
+
+void test_relaxed_order() {
+	std::cout << "\n=== Relaxed Order Test (sharded) ===" << std::endl;
+
+	ConcurrentPriorityQueue<int> queue(8);
+
+	for (int i = 0; i < 1000; ++i)
+		queue.push(i % 100, i % 100);
+
+	int highCount = 0;
+	int value;
+	for (int i = 0; i < 100; ++i) {
+		queue.tryPop(value);
+		if (value >= 90)
+			highCount++;
+	}
+
+	std::cout << "High priority items among first 100 pops: " << highCount << "/100" << std::endl;
+	std::cout << "Remaining size: " << queue.size() << std::endl;
+}
+
+void test_blocking_pop() {
+	std::cout << "\n=== Blocking Pop Test ===" << std::endl;
+
+	ConcurrentPriorityQueue<int> queue;
+	std::atomic<int> consumed{0};
+
+	std::vector<std::thread> consumers;
+	for (int c = 0; c < 4; ++c) {
+		consumers.emplace_back([&queue, &consumed, c]() {
+			threadSafeCout.setPrefix("[Consumer-" + std::to_string(c) + "] ");
+			int value;
+			while (queue.pop(value))
+				consumed.fetch_add(1);
+			threadSafeCout << "Queue closed, exiting" << std::endl;
+		});
+	}
+
+	std::vector<std::thread> producers;
+	for (int p = 0; p < 4; ++p) {
+		producers.emplace_back([&queue, p]() {
+			for (int i = 0; i < 10000; ++i)
+				queue.push(i % 7, p * 10000 + i);
+		});
+	}
+
+	for (auto &producer : producers)
+		producer.join();
+	while (!queue.empty())
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	queue.close();
+	for (auto &consumer : consumers)
+		consumer.join();
+
+	std::cout << "Consumed: " << consumed.load() << "/40000" << std::endl;
+}
+
+void test_closed_queue() {
+	std::cout << "\n=== Closed Queue Test ===" << std::endl;
+
+	ConcurrentPriorityQueue<int> queue;
+	queue.push(3, 42);
+	queue.close();
+
+	int value = 0;
+	std::cout << "Pop after close drains remaining items: " << std::boolalpha << queue.pop(value) << " (" << value << ")" << std::endl;
+	std::cout << "Pop on closed empty queue: " << queue.pop(value) << std::endl;
+
+	try {
+		queue.push(1, 1);
+	} catch (const std::runtime_error &e) {
+		std::cout << "Push on closed queue: " << e.what() << std::endl;
+	}
+}
+
+void test_size_never_wraps() {
+	std::cout << "\n=== Size Accounting Test ===" << std::endl;
+
+	ConcurrentPriorityQueue<int> queue(2);
+	std::atomic<bool> done(false);
+	std::atomic<bool> wrapped(false);
+
+	std::thread watcher([&]() {
+		while (!done.load()) {
+			if (queue.size() > 1000)
+				wrapped.store(true);
+		}
+	});
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++) {
+		threads.emplace_back([&queue]() {
+			int value = 0;
+			for (int i = 0; i < 20000; i++) {
+				queue.push(i % 7, i);
+				queue.tryPop(value);
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	done.store(true);
+	watcher.join();
+
+	int value = 0;
+	while (queue.tryPop(value)) {}
+	std::cout << "Size never wrapped: " << std::boolalpha << !wrapped.load() << std::endl;
+	std::cout << "Drained queue is empty: " << queue.empty() << std::endl;
+}
+
+int main() {
+	test_priority_order();
+	test_relaxed_order();
+	test_blocking_pop();
+	test_closed_queue();
+	test_size_never_wraps();
+
+	return 0;
+}
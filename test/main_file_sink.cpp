@@ -0,0 +1,231 @@
+#include "../libftpp.hpp"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <stdexcept>
+#include <future>
+
+namespace fs = std::filesystem;
+
+static fs::path makeTempDir() {
+	char pattern[] = "/tmp/libftpp_file_sink_XXXXXX";
+	if (!mkdtemp(pattern))
+		throw std::runtime_error("mkdtemp failed");
+	return fs::path(pattern);
+}
+
+static std::vector<std::string> readLines(const fs::path &path) {
+	std::vector<std::string> lines;
+	std::ifstream file(path);
+	std::string line;
+	while (std::getline(file, line))
+		lines.push_back(line);
+	return lines;
+}
+
+static Log::Record makeRecord(const std::string &message, Log::LogLevel level = Log::LogLevel::INFO) {
+	Log::Record record;
+	record.timestamp = std::chrono::system_clock::now();
+	record.level = level;
+	record.message = message;
+	record.loggerName = "sink";
+	record.source = Log::Source{"main_file_sink.cpp", 42, "test"};
+	record.threadId = std::this_thread::get_id();
+	return record;
+}
+
+static std::string messageOf(const std::string &line) {
+	size_t separator = line.find(" - ");
+	return separator == std::string::npos ? "" : line.substr(separator + 3);
+}
+
+void test_basic_and_levels(const fs::path &dir) {
+	std::cout << "=== Basic Writes and Levels Test ===" << std::endl;
+	fs::path path = dir / "basic.log";
+
+	{
+		Log::FileSink sink(path.string());
+		Log::Logger logger("FileTest");
+		logger.addSink(&sink);
+		logger.setLogLevel(Log::LogLevel::DEBUG);
+
+		for (int i = 0; i < 1000; ++i)
+			LOG_INFO(logger, "message " + std::to_string(i));
+		sink.set_level(Log::LogLevel::WARNING);
+		LOG_INFO(logger, "filtered");
+		LOG_ERROR(logger, "kept");
+		sink.sync();
+
+		std::vector<std::string> lines = readLines(path);
+		bool ordered = lines.size() == 1001;
+		for (size_t i = 0; ordered && i < 1000; ++i)
+			ordered = messageOf(lines[i]) == "message " + std::to_string(i);
+		std::cout << "All records in order after sync: " << (ordered ? "yes" : "no") << std::endl;
+		std::cout << "Line format: " << (lines.size() > 0 && lines[0].find(" [INFO] [FileTest] (") == 23 ? "yes" : "no") << std::endl;
+		std::cout << "Below-level record filtered: " << (lines.size() == 1001 && messageOf(lines.back()) == "kept" ? "yes" : "no") << std::endl;
+		std::cout << "Bytes counted: " << (sink.bytesWritten() == fs::file_size(path) ? "yes" : "no") << std::endl;
+		LOG_ERROR(logger, "written at destruction");
+		logger.clearSinks();
+	}
+	std::vector<std::string> lines = readLines(path);
+	std::cout << "Buffered record written on destruction: " << (!lines.empty() && messageOf(lines.back()) == "written at destruction" ? "yes" : "no") << std::endl;
+
+	Log::FileSink reopened(path.string());
+	reopened.write(makeRecord("appended"));
+	reopened.sync();
+	lines = readLines(path);
+	std::cout << "Reopening appends: " << (lines.size() == 1003 && messageOf(lines.back()) == "appended" ? "yes" : "no") << std::endl;
+	std::cout << std::endl;
+}
+
+void test_size_rotation(const fs::path &dir) {
+	std::cout << "=== Size Rotation Test ===" << std::endl;
+	fs::path path = dir / "size.log";
+	const int total = 2000;
+
+	Log::FileSink::Config config;
+	config.bufferSize = 1024;
+	config.rotateSize = 8192;
+	config.maxFiles = 3;
+	config.preallocate = 8192;
+	{
+		Log::FileSink sink(path.string(), config);
+		for (int i = 0; i < total; ++i) {
+			sink.write(makeRecord("record " + std::to_string(i)));
+			if (i % 50 == 0)
+				sink.sync();
+		}
+		sink.sync();
+		std::cout << "Rotated: " << (sink.rotations() > 3 ? "yes" : "no") << std::endl;
+	}
+
+	std::vector<std::string> kept;
+	bool sized = true;
+	for (int i = 3; i >= 0; --i) {
+		fs::path file = i ? fs::path(path.string() + "." + std::to_string(i)) : path;
+		if (!fs::exists(file))
+			continue;
+		if (fs::file_size(file) > config.rotateSize)
+			sized = false;
+		for (const std::string &line : readLines(file))
+			kept.push_back(messageOf(line));
+	}
+	bool contiguous = !kept.empty() && kept.back() == "record " + std::to_string(total - 1);
+	for (size_t i = 0; contiguous && i < kept.size(); ++i)
+		contiguous = kept[i] == "record " + std::to_string(total - kept.size() + i);
+	std::cout << "Files kept up to maxFiles: " << (fs::exists(path.string() + ".3") && !fs::exists(path.string() + ".4") ? "yes" : "no") << std::endl;
+	std::cout << "Files within rotateSize: " << (sized ? "yes" : "no") << std::endl;
+	std::cout << "Newest records contiguous across files: " << (contiguous ? "yes" : "no") << std::endl;
+	std::cout << std::endl;
+}
+
+void test_time_rotation(const fs::path &dir) {
+	std::cout << "=== Time Rotation Test ===" << std::endl;
+	fs::path path = dir / "time.log";
+
+	Log::FileSink::Config config;
+	config.rotateInterval = std::chrono::seconds(1);
+	Log::FileSink sink(path.string(), config);
+	sink.write(makeRecord("before"));
+	sink.sync();
+	std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+	sink.write(makeRecord("after"));
+	sink.sync();
+
+	std::vector<std::string> previous = readLines(path.string() + ".1");
+	std::vector<std::string> current = readLines(path);
+	std::cout << "Rotated after interval: " << (sink.rotations() == 1 ? "yes" : "no") << std::endl;
+	std::cout << "Old records moved to .1: " << (previous.size() == 1 && messageOf(previous[0]) == "before" ? "yes" : "no") << std::endl;
+	std::cout << "New file holds new records: " << (current.size() == 1 && messageOf(current[0]) == "after" ? "yes" : "no") << std::endl;
+	std::cout << std::endl;
+}
+
+void test_concurrent_writers(const fs::path &dir) {
+	std::cout << "=== Concurrent Writers Test ===" << std::endl;
+	fs::path path = dir / "concurrent.log";
+	const int threadCount = 4;
+	const int perThread = 20000;
+
+	Log::FileSink::Config config;
+	config.bufferSize = 16 * 1024;
+	config.fsync = Log::FsyncPolicy::PERIODIC;
+	config.fsyncInterval = std::chrono::milliseconds(10);
+	Log::FileSink sink(path.string(), config);
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < threadCount; ++t) {
+		threads.emplace_back([&sink, t]() {
+			for (int i = 0; i < perThread; ++i) {
+				sink.write(makeRecord(std::to_string(t) + ":" + std::to_string(i)));
+				sink.flush();
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+	sink.sync();
+
+	std::vector<std::string> lines = readLines(path);
+	std::vector<int> next(threadCount, 0);
+	bool ordered = true;
+	for (const std::string &line : lines) {
+		std::string message = messageOf(line);
+		int t = std::stoi(message.substr(0, message.find(':')));
+		int i = std::stoi(message.substr(message.find(':') + 1));
+		if (i != next[t])
+			ordered = false;
+		next[t] = i + 1;
+	}
+	std::cout << "Every line whole and present: " << (lines.size() == static_cast<size_t>(threadCount * perThread) ? "yes" : "no") << std::endl;
+	std::cout << "Per-thread order kept: " << (ordered ? "yes" : "no") << std::endl;
+	std::cout << "No write errors: " << (sink.writeErrors() == 0 ? "yes" : "no") << std::endl;
+	std::cout << std::endl;
+}
+
+void test_errors(const fs::path &dir) {
+	std::cout << "=== Error Handling Test ===" << std::endl;
+
+	try {
+		Log::FileSink sink((dir / "missing" / "file.log").string());
+		std::cout << "Unopenable path rejected: no" << std::endl;
+	} catch (const std::runtime_error &e) {
+		std::cout << "Unopenable path rejected: yes" << std::endl;
+	}
+	try {
+		Log::FileSink::Config config;
+		config.maxFiles = 0;
+		Log::FileSink sink((dir / "config.log").string(), config);
+		std::cout << "Invalid config rejected: no" << std::endl;
+	} catch (const std::runtime_error &e) {
+		std::cout << "Invalid config rejected: yes" << std::endl;
+	}
+
+	// fdatasync fails with EINVAL on /dev/null
+	Log::FileSink::Config config;
+	config.fsync = Log::FsyncPolicy::EVERY_WRITE;
+	Log::FileSink sink("/dev/null", config);
+	sink.write(makeRecord("discarded"));
+	std::future<void> synced = std::async(std::launch::async, [&sink]() { sink.sync(); });
+	std::cout << "sync() returns when fdatasync fails: " << (synced.wait_for(std::chrono::seconds(5)) == std::future_status::ready ? "yes" : "no") << std::endl;
+	synced.wait();
+	std::cout << "Failed fdatasync counted: " << (sink.writeErrors() > 0 ? "yes" : "no") << std::endl;
+	std::cout << std::endl;
+}
+
+int main() {
+	fs::path dir = makeTempDir();
+
+	test_basic_and_levels(dir);
+	test_size_rotation(dir);
+	test_time_rotation(dir);
+	test_concurrent_writers(dir);
+	test_errors(dir);
+
+	fs::remove_all(dir);
+	std::cout << "=== All FileSink Tests Completed ===" << std::endl;
+	return 0;
+}
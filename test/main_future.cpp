@@ -0,0 +1,167 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <numeric>
+#include <chrono>
+#include "../libftpp.hpp"
+
+void test_submit_result() {
+	std::cout << "\n=== Submit Result Test ===" << std::endl;
+
+	WorkerPool pool(4);
+
+	auto sum = pool.submit([](int a, int b) { return a + b; }, 20, 22);
+	auto text = pool.submit([](const std::string &name) { return "Hello " + name; }, std::string("worker"));
+	auto nothing = pool.submit([]() { threadSafeCout << "Void job executed" << std::endl; });
+
+	nothing.get();
+	std::cout << "Sum: " << sum.get() << std::endl;
+	std::cout << "Text: " << text.get() << std::endl;
+	std::cout << "Void future valid after get: " << std::boolalpha << nothing.valid() << std::endl;
+}
+
+void test_exception_propagation() {
+	std::cout << "\n=== Exception Propagation Test ===" << std::endl;
+
+	WorkerPool pool(2);
+
+	auto failing = pool.submit([]() -> int { throw std::runtime_error("job failed"); });
+	try {
+		failing.get();
+	} catch (const std::runtime_error &e) {
+		std::cout << "Caught from get(): " << e.what() << std::endl;
+	}
+
+	auto chained = pool.submit([]() -> int { throw std::runtime_error("first stage failed"); })
+		.then([](int value) { return value * 2; });
+	try {
+		chained.get();
+	} catch (const std::runtime_error &e) {
+		std::cout << "Caught through then(): " << e.what() << std::endl;
+	}
+}
+
+void test_then_chain() {
+	std::cout << "\n=== Then Chain Test ===" << std::endl;
+
+	WorkerPool pool(4);
+
+	auto result = pool.submit([]() { return 10; })
+		.then([](int value) { return value * 3; })
+		.then([](int value) { return std::to_string(value) + " items"; });
+
+	std::cout << "Chained result: " << result.get() << std::endl;
+}
+
+void test_when_all_any() {
+	std::cout << "\n=== whenAll / whenAny Test ===" << std::endl;
+
+	WorkerPool pool(4);
+
+	std::vector<Future<int>> squares;
+	for (int i = 1; i <= 10; ++i)
+		squares.push_back(pool.submit([i]() { return i * i; }));
+
+	std::vector<int> values = whenAll(std::move(squares)).get();
+	std::cout << "Sum of squares: " << std::accumulate(values.begin(), values.end(), 0) << std::endl;
+
+	std::vector<Future<std::string>> racers;
+	racers.push_back(pool.submit([]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(200));
+		return std::string("slow");
+	}));
+	racers.push_back(pool.submit([]() { return std::string("fast"); }));
+
+	auto first = whenAny(std::move(racers)).get();
+	std::cout << "First ready: index " << first.index << " -> " << first.futures[first.index].get() << std::endl;
+}
+
+int parallelFib(WorkerPool &pool, int n) {
+	if (n < 12)
+		return n < 2 ? n : parallelFib(pool, n - 1) + parallelFib(pool, n - 2);
+	auto left = pool.submit(parallelFib, std::ref(pool), n - 1);
+	int right = parallelFib(pool, n - 2);
+	return left.get() + right;
+}
+
+void test_wait_inside_worker() {
+	std::cout << "\n=== Waiting Inside Worker Test ===" << std::endl;
+
+	// A single worker would deadlock if get() blocked instead of helping
+	WorkerPool pool(1);
+
+	auto result = pool.submit(parallelFib, std::ref(pool), 22);
+	std::cout << "fib(22) on 1 worker: " << result.get() << std::endl;
+}
+
+void test_promise() {
+	std::cout << "\n=== Promise Test ===" << std::endl;
+
+	WorkerPool pool(2);
+	Promise<int> promise;
+	Future<int> future = promise.getFuture(&pool);
+
+	std::thread producer([&promise]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		promise.setValue(7);
+	});
+
+	std::cout << "Promise value: " << future.get() << std::endl;
+	producer.join();
+}
+
+void test_broken_promise() {
+	std::cout << "\n=== Broken Promise Test ===" << std::endl;
+
+	std::vector<Future<int>> pending;
+	Future<int> chained;
+	{
+		// The single worker is busy while the pool is destroyed
+		WorkerPool pool(1);
+		pool.addJob([]() { std::this_thread::sleep_for(std::chrono::milliseconds(100)); });
+		for (int i = 0; i < 3; ++i)
+			pending.push_back(pool.submit([i]() { return i; }));
+		chained = pool.submit([]() { return 1; }).then([](int value) { return value + 1; });
+	}
+
+	size_t broken = 0;
+	for (auto &future : pending) {
+		try {
+			future.get();
+		} catch (const std::future_error &e) {
+			broken += e.code() == std::future_errc::broken_promise;
+		}
+	}
+	std::cout << "Dropped submits throw broken_promise: " << broken << "/3" << std::endl;
+
+	try {
+		chained.get();
+		std::cout << "Chained future broken: no" << std::endl;
+	} catch (const std::future_error &e) {
+		std::cout << "Chained future broken: " << (e.code() == std::future_errc::broken_promise ? "yes" : "no") << std::endl;
+	}
+
+	Future<void> orphan;
+	{
+		Promise<void> promise;
+		orphan = promise.getFuture();
+	}
+	try {
+		orphan.get();
+		std::cout << "Destroyed promise breaks its future: no" << std::endl;
+	} catch (const std::future_error &) {
+		std::cout << "Destroyed promise breaks its future: yes" << std::endl;
+	}
+}
+
+int main() {
+	test_submit_result();
+	test_exception_propagation();
+	test_then_chain();
+	test_when_all_any();
+	test_wait_inside_worker();
+	test_promise();
+	test_broken_promise();
+
+	return 0;
+}
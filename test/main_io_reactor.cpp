@@ -0,0 +1,76 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "../libftpp.hpp"
+
+static bool waitFor(const std::atomic<int> &value, int expected) {
+	auto start = std::chrono::steady_clock::now();
+	while (value.load() < expected && std::chrono::steady_clock::now() - start < std::chrono::seconds(2))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	return value.load() >= expected;
+}
+
+void test_readiness_callbacks() {
+	std::cout << "\n=== Readiness Callbacks Test ===" << std::endl;
+
+	WorkerPool pool(2);
+	IoReactor reactor(pool);
+	int sockets[2];
+	socketpair(AF_UNIX, SOCK_STREAM, 0, sockets);
+
+	std::atomic<int> reads{0};
+	std::atomic<int> writes{0};
+	reactor.watch(sockets[1], IoReactor::Interest::READ, Job([&]() {
+		char buffer[16];
+		ssize_t received = ::recv(sockets[1], buffer, sizeof(buffer), 0);
+		std::cout << "Read callback received " << received << " bytes on a worker: "
+				  << (pool.isWorkerThread() ? "yes" : "no") << std::endl;
+		reads.fetch_add(1);
+	}));
+	reactor.watch(sockets[1], IoReactor::Interest::WRITE, Job([&]() { writes.fetch_add(1); }));
+
+	std::cout << "Writable socket reported: " << (waitFor(writes, 1) ? "yes" : "no") << std::endl;
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	std::cout << "No read before data: " << (reads.load() == 0 ? "yes" : "no") << std::endl;
+
+	::send(sockets[0], "hello", 5, 0);
+	std::cout << "Read fired after data: " << (waitFor(reads, 1) ? "yes" : "no") << std::endl;
+
+	try {
+		reactor.watch(sockets[1], IoReactor::Interest::READ, Job([]() {}));
+		reactor.watch(sockets[1], IoReactor::Interest::READ, Job([]() {}));
+	} catch (const std::exception &e) {
+		std::cout << "Duplicate waiter rejected: " << e.what() << std::endl;
+	}
+	reactor.cancel(sockets[1]);
+	std::cout << "Watched after cancel: " << reactor.watched() << std::endl;
+
+	close(sockets[0]);
+	close(sockets[1]);
+}
+
+void test_hangup() {
+	std::cout << "\n=== Hang-up Test ===" << std::endl;
+
+	WorkerPool pool(1);
+	IoReactor reactor(pool);
+	int sockets[2];
+	socketpair(AF_UNIX, SOCK_STREAM, 0, sockets);
+
+	std::atomic<int> fired{0};
+	reactor.watch(sockets[1], IoReactor::Interest::READ, Job([&]() { fired.fetch_add(1); }));
+	close(sockets[0]);
+	std::cout << "Peer close wakes reader: " << (waitFor(fired, 1) ? "yes" : "no") << std::endl;
+	close(sockets[1]);
+}
+
+int main() {
+	test_readiness_callbacks();
+	test_hangup();
+
+	std::cout << "\nAll IoReactor tests completed!" << std::endl;
+	return 0;
+}
@@ -0,0 +1,56 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <array>
+#include "../libftpp.hpp"
+
+void test_inline_storage() {
+	std::cout << "\n=== Inline Storage Test ===" << std::endl;
+
+	int counter = 0;
+	Job small([&counter]() { ++counter; });
+	std::array<char, 256> big{};
+	Job large([big, &counter]() { counter += static_cast<int>(big.size()); });
+
+	small();
+	large();
+	std::cout << "Small capture inline: " << (small.isInline() ? "yes" : "no") << std::endl;
+	std::cout << "Large capture inline: " << (large.isInline() ? "yes" : "no") << std::endl;
+	std::cout << "Counter: " << counter << std::endl;
+}
+
+void test_move_only() {
+	std::cout << "\n=== Move-Only Callable Test ===" << std::endl;
+
+	auto value = std::make_unique<std::string>("moved into job");
+	Job job([value = std::move(value)]() { std::cout << "Running: " << *value << std::endl; });
+	Job other(std::move(job));
+
+	std::cout << "Source empty after move: " << (!job ? "yes" : "no") << std::endl;
+	other();
+	other.reset();
+	std::cout << "Empty after reset: " << (!other ? "yes" : "no") << std::endl;
+}
+
+void test_destruction() {
+	std::cout << "\n=== Destruction Test ===" << std::endl;
+
+	auto tracker = std::make_shared<int>(42);
+	{
+		Job job([tracker]() {});
+		std::cout << "Owners while job alive: " << tracker.use_count() << std::endl;
+		Job assigned;
+		assigned = std::move(job);
+		std::cout << "Owners after move-assign: " << tracker.use_count() << std::endl;
+	}
+	std::cout << "Owners after job destroyed: " << tracker.use_count() << std::endl;
+}
+
+int main() {
+	test_inline_storage();
+	test_move_only();
+	test_destruction();
+
+	std::cout << "\nAll Job tests completed!" << std::endl;
+	return 0;
+}
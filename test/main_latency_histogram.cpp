@@ -0,0 +1,77 @@
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+#include "../libftpp.hpp"
+
+void test_percentiles() {
+	std::cout << "\n=== Percentiles Test ===" << std::endl;
+
+	LatencyHistogram histogram;
+	for (uint64_t value = 1; value <= 1000; ++value)
+		histogram.record(value);
+
+	LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+	std::cout << "Count: " << snapshot.count << ", mean: " << snapshot.mean() << ", max: " << snapshot.max << std::endl;
+	for (double p : {0.5, 0.9, 0.99}) {
+		double value = snapshot.percentile(p);
+		double expected = p * 1000;
+		std::cout << "p" << static_cast<int>(p * 100) << " within 12.5%: "
+				  << (value > expected * 0.875 && value < expected * 1.125 ? "yes" : "no") << std::endl;
+	}
+}
+
+void test_buckets() {
+	std::cout << "\n=== Bucket Boundaries Test ===" << std::endl;
+
+	bool consistent = true;
+	for (uint64_t value : {0ull, 3ull, 4ull, 7ull, 8ull, 1000ull, 123456789ull, ~0ull}) {
+		size_t index = LatencyHistogram::bucketIndex(value);
+		consistent = consistent && LatencyHistogram::bucketLowerBound(index) <= value
+			&& (index + 1 == LatencyHistogram::BucketCount || value < LatencyHistogram::bucketLowerBound(index + 1)
+				|| LatencyHistogram::bucketLowerBound(index + 1) == 0);
+	}
+	std::cout << "Values fall inside their bucket: " << (consistent ? "yes" : "no") << std::endl;
+}
+
+void test_merge_and_concurrent_snapshot() {
+	std::cout << "\n=== Merge / Concurrent Snapshot Test ===" << std::endl;
+
+	LatencyHistogram first;
+	LatencyHistogram second;
+	std::atomic<bool> done{false};
+
+	std::thread writer([&]() {
+		for (int i = 0; i < 1000000; ++i)
+			first.record(static_cast<uint64_t>(i % 500));
+		done.store(true);
+	});
+	while (!done.load())
+		first.snapshot();
+	writer.join();
+	for (int i = 0; i < 1000; ++i)
+		second.record(10000);
+
+	LatencyHistogram::Snapshot merged = first.snapshot();
+	merged.merge(second.snapshot());
+	std::cout << "Merged count: " << merged.count << ", max: " << merged.max << std::endl;
+}
+
+void test_cycle_clock() {
+	std::cout << "\n=== CycleClock Test ===" << std::endl;
+
+	uint64_t start = CycleClock::now();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	double elapsed = CycleClock::toNanoseconds(CycleClock::now() - start) / 1e6;
+	std::cout << "20 ms sleep measured within [19, 40] ms: " << (elapsed >= 19 && elapsed <= 40 ? "yes" : "no") << std::endl;
+}
+
+int main() {
+	test_percentiles();
+	test_buckets();
+	test_merge_and_concurrent_snapshot();
+	test_cycle_clock();
+
+	std::cout << "\nAll LatencyHistogram tests completed!" << std::endl;
+	return 0;
+}
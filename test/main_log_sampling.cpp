@@ -0,0 +1,204 @@
+#include "../libftpp.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <future>
+#include <chrono>
+
+class RecordingSink : public Log::Sink {
+public:
+    void write(const Log::Record& record) override {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (record.message == "block") {
+            _blocked = true;
+            _condition.notify_all();
+            _condition.wait(lock, [this]() { return _released; });
+        }
+        _messages.push_back(record.message);
+    }
+    void flush() override {}
+    void set_level(Log::LogLevel) override {}
+
+    std::vector<std::string> messages() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _messages;
+    }
+    void clear() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _messages.clear();
+    }
+    void waitBlocked() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _blocked; });
+    }
+    void release() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _released = true;
+        _condition.notify_all();
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::vector<std::string> _messages;
+    bool _blocked = false;
+    bool _released = false;
+};
+
+static const char *yesNo(bool value) {
+    return value ? "yes" : "no";
+}
+
+static size_t countPrefix(const std::vector<std::string>& messages, const std::string& prefix) {
+    size_t count = 0;
+    for (const std::string& message : messages)
+        count += message.compare(0, prefix.size(), prefix) == 0;
+    return count;
+}
+
+void test_every_n() {
+    std::cout << "=== LOG_EVERY_N Test ===" << std::endl;
+    Log::Logger logger("Sampling");
+    RecordingSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::DEBUG);
+
+    for (int i = 0; i < 1000; ++i)
+        LOG_EVERY_N(logger, WARNING, 100, "event {}", i);
+    std::vector<std::string> messages = sink.messages();
+    bool sampled = messages.size() == 10;
+    for (size_t i = 0; sampled && i < messages.size(); ++i)
+        sampled = messages[i] == "event " + std::to_string(i * 100);
+    std::cout << "Calls 1, n + 1, 2n + 1... logged: " << yesNo(sampled) << std::endl;
+
+    sink.clear();
+    for (int i = 0; i < 10; ++i) {
+        LOG_EVERY_N(logger, INFO, 5, "first site");
+        LOG_EVERY_N(logger, INFO, 2, "second site");
+    }
+    messages = sink.messages();
+    std::cout << "Each call site counts alone: " << yesNo(countPrefix(messages, "first") == 2 && countPrefix(messages, "second") == 5) << std::endl;
+
+    int evaluations = 0;
+    auto expensive = [&evaluations]() { return ++evaluations; };
+    for (int i = 0; i < 100; ++i)
+        LOG_EVERY_N(logger, INFO, 10, "value {}", expensive());
+    std::cout << "Suppressed arguments not evaluated: " << yesNo(evaluations == 10) << std::endl;
+    std::cout << std::endl;
+}
+
+void test_first_n() {
+    std::cout << "=== LOG_FIRST_N Test ===" << std::endl;
+    Log::Logger logger("Sampling");
+    RecordingSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::WARNING);
+
+    for (int i = 0; i < 20; ++i)
+        LOG_FIRST_N(logger, INFO, 3, "filtered {}", i);
+    logger.setLogLevel(Log::LogLevel::DEBUG);
+    for (int i = 0; i < 20; ++i)
+        LOG_FIRST_N(logger, INFO, 3, "kept {}", i);
+    std::vector<std::string> messages = sink.messages();
+    std::cout << "Filtered calls use no budget: " << yesNo(countPrefix(messages, "filtered") == 0) << std::endl;
+    std::cout << "First n logged, then one summary: "
+              << yesNo(messages.size() == 4 && messages[0] == "kept 0" && messages[2] == "kept 2"
+                       && messages[3] == "Logged the first 3 messages from here; suppressing the rest") << std::endl;
+    std::cout << std::endl;
+}
+
+void test_rate_limited() {
+    std::cout << "=== LOG_RATE_LIMITED Test ===" << std::endl;
+    Log::Logger logger("Sampling");
+    RecordingSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::DEBUG);
+
+    // Long enough to cross at least one window boundary whatever the phase
+    auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(1500);
+    uint64_t calls = 0;
+    while (std::chrono::steady_clock::now() < end) {
+        LOG_RATE_LIMITED(logger, ERROR, 50, "failure {}", calls);
+        ++calls;
+    }
+    std::vector<std::string> messages = sink.messages();
+    size_t logged = countPrefix(messages, "failure");
+    std::string summaryPrefix = "Suppressed ";
+    uint64_t reported = 0;
+    size_t summaries = 0;
+    for (const std::string& message : messages) {
+        if (message.compare(0, summaryPrefix.size(), summaryPrefix) == 0) {
+            reported += std::stoull(message.substr(summaryPrefix.size()));
+            ++summaries;
+        }
+    }
+    std::cout << "At most the rate per window: " << yesNo(logged > 50 && logged <= 150) << std::endl;
+    std::cout << "Summary when a new window opens: " << yesNo(summaries >= 1 && summaries <= 2) << std::endl;
+    std::cout << "Summaries count closed windows: " << yesNo(reported > 0 && logged + reported <= calls) << std::endl;
+    std::cout << std::endl;
+}
+
+void test_concurrent() {
+    std::cout << "=== Concurrent Call Sites Test ===" << std::endl;
+    Log::Logger logger("Sampling");
+    RecordingSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::DEBUG);
+
+    const int threadCount = 4;
+    const int perThread = 100000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&logger]() {
+            for (int i = 0; i < perThread; ++i) {
+                LOG_EVERY_N(logger, INFO, 1000, "every");
+                LOG_FIRST_N(logger, INFO, 25, "first");
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    std::vector<std::string> messages = sink.messages();
+    std::cout << "EVERY_N exact across threads: " << yesNo(countPrefix(messages, "every") == threadCount * perThread / 1000) << std::endl;
+    std::cout << "FIRST_N exact across threads: " << yesNo(countPrefix(messages, "first") == 25 && countPrefix(messages, "Logged the first") == 1) << std::endl;
+    std::cout << std::endl;
+}
+
+void test_no_logger_lock() {
+    std::cout << "=== Lock-Free Suppression Test ===" << std::endl;
+    Log::Logger logger("Sampling");
+    RecordingSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::DEBUG);
+
+    auto exhaust = [&logger]() {
+        for (int i = 0; i < 100000; ++i) {
+            LOG_FIRST_N(logger, WARNING, 1, "first");
+            LOG_EVERY_N(logger, WARNING, 1000000, "every");
+        }
+    };
+    exhaust();
+
+    std::thread holder([&logger]() { LOG_INFO(logger, "block"); });
+    sink.waitBlocked();
+    std::future<void> suppressed = std::async(std::launch::async, exhaust);
+    bool finished = suppressed.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    sink.release();
+    holder.join();
+    suppressed.wait();
+    std::cout << "Suppressed calls finish while a sink holds the logger: " << yesNo(finished) << std::endl;
+    std::cout << std::endl;
+}
+
+int main() {
+    test_every_n();
+    test_first_n();
+    test_rate_limited();
+    test_concurrent();
+    test_no_logger_lock();
+    std::cout << "=== All Log Sampling Tests Completed ===" << std::endl;
+    return 0;
+}
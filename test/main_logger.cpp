@@ -4,6 +4,8 @@
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <mutex>
+#include <string>
 #include "../libftpp.hpp"
 
 // ✅ Console Sink Implementation
@@ -328,6 +330,190 @@ void test_edge_cases() {
     std::cout << std::endl;
 }
 
+// ✅ Sink recording what it receives, optionally slow
+class RecordingSink : public Log::Sink {
+private:
+    std::mutex _mutex;
+    std::vector<std::string> _messages;
+    int _flushes = 0;
+    std::chrono::microseconds _delay;
+
+public:
+    explicit RecordingSink(std::chrono::microseconds delay = std::chrono::microseconds(0)) : _delay(delay) {}
+
+    void write(const Log::Record& record) override {
+        if (_delay.count())
+            std::this_thread::sleep_for(_delay);
+        std::lock_guard<std::mutex> lock(_mutex);
+        _messages.push_back(record.message);
+    }
+
+    void flush() override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _flushes++;
+    }
+
+    void set_level(Log::LogLevel) override {}
+
+    std::vector<std::string> messages() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _messages;
+    }
+
+    int flushes() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _flushes;
+    }
+};
+
+void test_async_logging() {
+    std::cout << "=== Testing Async Logging ===" << std::endl;
+
+    Log::Logger logger("AsyncTest");
+    RecordingSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::INFO);
+    logger.startAsync();
+    std::cout << "Async mode: " << (logger.isAsync() ? "yes" : "no") << std::endl;
+
+    const int numThreads = 4;
+    const int messagesPerThread = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&logger, t]() {
+            for (int i = 0; i < messagesPerThread; ++i)
+                LOG_INFO(logger, std::to_string(t) + " " + std::to_string(i));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    logger.flush();
+
+    std::vector<std::string> messages = sink.messages();
+    std::vector<int> next(numThreads, 0);
+    bool ordered = true;
+    for (const std::string& message : messages) {
+        int t = std::stoi(message.substr(0, message.find(' ')));
+        int i = std::stoi(message.substr(message.find(' ') + 1));
+        if (i != next[t])
+            ordered = false;
+        next[t] = i + 1;
+    }
+    std::cout << "All records delivered after flush: " << (messages.size() == numThreads * messagesPerThread ? "yes" : "no") << std::endl;
+    std::cout << "Per-thread order kept: " << (ordered ? "yes" : "no") << std::endl;
+    std::cout << "Sink flushed per batch, not per record: " << (sink.flushes() < static_cast<int>(messages.size()) ? "yes" : "no") << std::endl;
+    std::cout << "Nothing dropped: " << (logger.droppedRecords() == 0 ? "yes" : "no") << std::endl;
+
+    logger.stopAsync();
+    LOG_INFO(logger, "sync again");
+    std::cout << "Synchronous after stop: " << (!logger.isAsync() && sink.messages().back() == "sync again" ? "yes" : "no") << std::endl;
+    std::cout << std::endl;
+}
+
+void test_async_overflow() {
+    std::cout << "=== Testing Async Overflow Policies ===" << std::endl;
+
+    const int total = 500;
+    const char *names[] = {"BLOCK", "DROP_NEWEST", "DROP_OLDEST"};
+    Log::OverflowPolicy policies[] = {Log::OverflowPolicy::BLOCK, Log::OverflowPolicy::DROP_NEWEST, Log::OverflowPolicy::DROP_OLDEST};
+
+    for (int p = 0; p < 3; ++p) {
+        Log::Logger logger("OverflowTest");
+        RecordingSink sink(std::chrono::microseconds(200));
+        logger.addSink(&sink);
+        logger.setLogLevel(Log::LogLevel::INFO);
+
+        Log::AsyncConfig config;
+        config.capacity = 16;
+        config.overflow = policies[p];
+        config.batchSize = 4;
+        logger.startAsync(config);
+        for (int i = 0; i < total; ++i)
+            LOG_INFO(logger, std::to_string(i));
+        logger.flush();
+
+        std::vector<std::string> messages = sink.messages();
+        uint64_t dropped = logger.droppedRecords();
+        bool accounted = messages.size() + dropped == static_cast<size_t>(total);
+        std::cout << names[p] << ": delivered " << (messages.size() == static_cast<size_t>(total) ? "all" : "some")
+                  << ", dropped " << (dropped ? "some" : "none")
+                  << ", accounted " << (accounted ? "yes" : "no");
+        if (policies[p] == Log::OverflowPolicy::DROP_NEWEST)
+            std::cout << ", first kept " << (!messages.empty() && messages.front() == "0" ? "yes" : "no");
+        if (policies[p] == Log::OverflowPolicy::DROP_OLDEST)
+            std::cout << ", last kept " << (!messages.empty() && messages.back() == std::to_string(total - 1) ? "yes" : "no");
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+void test_async_stop_race() {
+    std::cout << "=== Testing Async Stop While Logging ===" << std::endl;
+
+    const int numThreads = 4;
+    const int messagesPerThread = 500;
+    bool complete = true;
+
+    // Records are either drained by stopAsync() or logged synchronously,
+    // so every one has reached the sink once the writers are joined
+    for (int round = 0; round < 100 && complete; ++round) {
+        Log::Logger logger("StopRace");
+        RecordingSink sink;
+        logger.addSink(&sink);
+        logger.setLogLevel(Log::LogLevel::INFO);
+
+        Log::AsyncConfig config;
+        config.capacity = 64;
+        config.overflow = Log::OverflowPolicy::BLOCK;
+        logger.startAsync(config);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < numThreads; ++t) {
+            threads.emplace_back([&logger]() {
+                for (int i = 0; i < messagesPerThread; ++i)
+                    LOG_INFO(logger, "entry");
+            });
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(round * 10));
+        logger.stopAsync();
+        for (auto& thread : threads)
+            thread.join();
+        complete = sink.messages().size() == static_cast<size_t>(numThreads * messagesPerThread) && logger.droppedRecords() == 0;
+    }
+    std::cout << "No record lost by stopAsync(): " << (complete ? "yes" : "no") << std::endl;
+    std::cout << std::endl;
+}
+
+void test_lazy_evaluation() {
+    std::cout << "=== Testing Lazy Message Evaluation ===" << std::endl;
+
+    Log::Logger logger("LazyTest");
+    RecordingSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::WARNING);
+
+    int evaluations = 0;
+    auto expensive = [&evaluations](const std::string& text) {
+        ++evaluations;
+        return text;
+    };
+    LOG_DEBUG(logger, expensive("debug"));
+    LOG_INFO(logger, expensive("info"));
+    std::cout << "Filtered messages not built: " << (evaluations == 0 && sink.messages().empty() ? "yes" : "no") << std::endl;
+
+    LOG_ERROR(logger, expensive("error"));
+    std::cout << "Passing message built once: " << (evaluations == 1 && sink.messages().size() == 1 ? "yes" : "no") << std::endl;
+
+    int loggerEvaluations = 0;
+    auto pick = [&]() -> Log::Logger& { ++loggerEvaluations; return logger; };
+    LOG_CRITICAL(pick(), "once");
+    std::cout << "Logger expression evaluated once: " << (loggerEvaluations == 1 ? "yes" : "no") << std::endl;
+
+    logger.setLogLevel(Log::LogLevel::DEBUG);
+    LOG_DEBUG(logger, expensive("debug"));
+    std::cout << "Level change seen by next statement: " << (evaluations == 2 && sink.messages().back() == "debug" ? "yes" : "no") << std::endl;
+    std::cout << std::endl;
+}
+
 int main() {
     std::cout << "Logger Class Comprehensive Test Suite" << std::endl;
     std::cout << "=====================================" << std::endl;
@@ -341,6 +527,10 @@ int main() {
         test_thread_safety();
         test_performance();
         test_edge_cases();
+        test_async_logging();
+        test_async_overflow();
+        test_async_stop_race();
+        test_lazy_evaluation();
         
         std::cout << "=== All Tests Completed Successfully ===" << std::endl;
         
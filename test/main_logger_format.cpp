@@ -0,0 +1,166 @@
+#include "../libftpp.hpp"
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+
+/*
+** Counts the heap allocations of each thread so the format-string macros
+** can be checked to allocate nothing on the caller once warmed up.
+*/
+static thread_local size_t allocations = 0;
+
+void *operator new(std::size_t size) {
+    ++allocations;
+    if (void *memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete[](void *memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+// Keeps the last message in a fixed buffer so that the sink itself never allocates
+class LastMessageSink : public Log::Sink {
+public:
+    char last[256] = {};
+    size_t count = 0;
+
+    void write(const Log::Record& record) override {
+        size_t length = std::min(record.message.size(), sizeof(last) - 1);
+        std::memcpy(last, record.message.data(), length);
+        last[length] = '\0';
+        ++count;
+    }
+    void flush() override {}
+    void set_level(Log::LogLevel) override {}
+};
+
+enum class Color { RED = 2 };
+
+static const char *yesNo(bool value) {
+    return value ? "yes" : "no";
+}
+
+void test_formatting() {
+    std::cout << "=== Format String Test ===" << std::endl;
+    Log::Logger logger("Format");
+    LastMessageSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::DEBUG);
+
+    LOG_INFO(logger, "user {} took {} ms", 42, 3.5);
+    std::cout << "Integers and doubles: " << yesNo(std::string(sink.last) == "user 42 took 3.5 ms") << std::endl;
+
+    std::string name = "alice";
+    std::string_view view = "view";
+    const char *missing = nullptr;
+    LOG_WARNING(logger, "{} {} {} {} {} {} {} {}", true, 'x', -7, 18446744073709551615ull, name, view, missing, "literal");
+    std::cout << "Bool, char, strings: " << yesNo(std::string(sink.last) == "true x -7 18446744073709551615 alice view (null) literal") << std::endl;
+
+    LOG_ERROR(logger, "{{braces}} {} {}", Color::RED, 1.0 / 3);
+    std::cout << "Escapes and enums: " << yesNo(std::string(sink.last) == "{braces} 2 0.333333") << std::endl;
+
+    int value = 0;
+    LOG_DEBUG(logger, "pointer {}", &value);
+    std::cout << "Pointers in hex: " << yesNo(std::strncmp(sink.last, "pointer 0x", 10) == 0) << std::endl;
+
+    LOG_INFO(logger, "plain {message} kept as is");
+    std::cout << "Single argument is the message: " << yesNo(std::string(sink.last) == "plain {message} kept as is") << std::endl;
+
+    LOG_INFO(logger, std::string("built ") + "string");
+    std::cout << "String expressions still work: " << yesNo(std::string(sink.last) == "built string") << std::endl;
+
+    std::string direct;
+    Log::formatTo(direct, "{} and {}", 1);
+    std::cout << "Missing arguments leave placeholders: " << yesNo(direct == "1 and {}") << std::endl;
+    std::cout << std::endl;
+}
+
+void test_lazy_arguments() {
+    std::cout << "=== Lazy Argument Test ===" << std::endl;
+    Log::Logger logger("Format");
+    LastMessageSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::WARNING);
+
+    int evaluations = 0;
+    auto expensive = [&evaluations]() {
+        ++evaluations;
+        return 7;
+    };
+    LOG_INFO(logger, "value {}", expensive());
+    std::cout << "Filtered arguments not evaluated: " << yesNo(evaluations == 0 && sink.count == 0) << std::endl;
+    LOG_ERROR(logger, "value {}", expensive());
+    std::cout << "Passing arguments evaluated once: " << yesNo(evaluations == 1 && std::string(sink.last) == "value 7") << std::endl;
+    std::cout << std::endl;
+}
+
+static size_t allocationsDuring(Log::Logger& logger, size_t iterations) {
+    std::string name = "a string longer than the small-string buffer";
+    std::string_view view = "view";
+    int value = 0;
+
+    size_t before = allocations;
+    for (size_t i = 0; i < iterations; ++i) {
+        LOG_INFO(logger, "user {} took {} ms", static_cast<int>(i), i * 0.25);
+        LOG_INFO(logger, "{} {} {} {} {} {} {}", i, true, 'c', name, view, "literal", &value);
+        LOG_DEBUG(logger, "filtered {}", name);
+    }
+    return allocations - before;
+}
+
+void test_allocations() {
+    std::cout << "=== Allocation Test ===" << std::endl;
+    Log::Logger logger("a logger name longer than sixteen");
+    LastMessageSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::INFO);
+
+    size_t before = allocations;
+    LOG_INFO(logger, "user " + std::to_string(123456789) + " took " + std::to_string(0.25) + " ms");
+    std::cout << "Counter sees string concatenation: " << yesNo(allocations > before) << std::endl;
+
+    allocationsDuring(logger, 16);
+    size_t count = allocationsDuring(logger, 10000);
+    std::cout << "Synchronous logging allocates nothing: " << yesNo(count == 0 && sink.count == 20033) << std::endl;
+
+    Log::AsyncConfig config;
+    config.capacity = 64;
+    config.batchSize = 16;
+    logger.startAsync(config);
+    allocationsDuring(logger, 1000);
+    logger.flush();
+    count = allocationsDuring(logger, 10000);
+    logger.flush();
+    std::cout << "Async logging allocates nothing on the caller: " << yesNo(count == 0) << std::endl;
+    logger.stopAsync();
+    std::cout << std::endl;
+}
+
+int main() {
+    test_formatting();
+    test_lazy_arguments();
+    test_allocations();
+    std::cout << "=== All Format Logging Tests Completed ===" << std::endl;
+    return 0;
+}
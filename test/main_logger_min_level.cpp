@@ -0,0 +1,46 @@
+#define LIBFTPP_LOG_MIN_LEVEL 3
+
+#include "../libftpp.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+** Built with LIBFTPP_LOG_MIN_LEVEL at WARNING: DEBUG, TRACE and INFO
+** statements must vanish even when the logger itself would accept them.
+*/
+class CountingSink : public Log::Sink {
+public:
+    std::vector<std::string> messages;
+
+    void write(const Log::Record& record) override { messages.push_back(record.message); }
+    void flush() override {}
+    void set_level(Log::LogLevel) override {}
+};
+
+int main() {
+    std::cout << "=== Compile-Time Minimum Level Test ===" << std::endl;
+
+    Log::Logger logger("MinLevel");
+    CountingSink sink;
+    logger.addSink(&sink);
+    logger.setLogLevel(Log::LogLevel::DEBUG);
+
+    int evaluations = 0;
+    auto expensive = [&evaluations](const std::string& text) {
+        ++evaluations;
+        return text;
+    };
+    LOG_DEBUG(logger, expensive("debug"));
+    LOG_TRACE(logger, expensive("trace"));
+    LOG_INFO(logger, expensive("info"));
+    std::cout << "Statements below the minimum compiled out: " << (evaluations == 0 && sink.messages.empty() ? "yes" : "no") << std::endl;
+
+    LOG_WARNING(logger, expensive("warning"));
+    LOG_CRITICAL(logger, expensive("critical"));
+    std::cout << "Statements at or above the minimum kept: " << (evaluations == 2 && sink.messages.size() == 2 ? "yes" : "no") << std::endl;
+
+    logger.log(Log::LogLevel::INFO, "direct call", Log::Source{__FILE__, __LINE__, __func__});
+    std::cout << "Direct log() calls unaffected: " << (sink.messages.size() == 3 ? "yes" : "no") << std::endl;
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <iostream>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <random>
+#include <atomic>
+#include "../libftpp.hpp"
+
+void test_parallel_for() {
+	std::cout << "\n=== parallelFor Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	std::vector<int> values(100000, 1);
+
+	parallelFor(pool, values.begin(), values.end(), [](int &value) { value *= 3; });
+	std::cout << "Element loop sum: " << std::accumulate(values.begin(), values.end(), 0L) << " (expected 300000)" << std::endl;
+
+	std::vector<float> noise(1000);
+	parallelFor(pool, size_t(0), noise.size(), 64, [&noise](size_t i) {
+		noise[i] = static_cast<float>(i) * 0.5f;
+	});
+	std::cout << "Index loop noise[999]: " << noise[999] << std::endl;
+}
+
+void test_parallel_reduce() {
+	std::cout << "\n=== parallelReduce Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	std::vector<long> values(1000000);
+	std::iota(values.begin(), values.end(), 1);
+
+	long sum = parallelReduce(pool, values.begin(), values.end(), 0L);
+	long maximum = parallelReduce(pool, values.begin(), values.end(), 0L, [](long a, long b) { return std::max(a, b); }, 1000);
+
+	std::cout << "Sum: " << sum << " (expected " << std::accumulate(values.begin(), values.end(), 0L) << ")" << std::endl;
+	std::cout << "Max: " << maximum << std::endl;
+}
+
+// No default constructor: partial results must not need one
+struct Distance {
+	explicit Distance(long value) : meters(value) {}
+	long meters;
+};
+
+static Distance operator+(const Distance &left, const Distance &right) {
+	return Distance(left.meters + right.meters);
+}
+
+void test_no_default_constructor() {
+	std::cout << "\n=== Non-Default-Constructible Values Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	std::vector<Distance> legs;
+	for (long i = 1; i <= 10000; ++i)
+		legs.emplace_back(i);
+
+	Distance total = parallelReduce(pool, legs.begin(), legs.end(), Distance(0), std::plus<Distance>(), 100);
+	std::vector<Distance> running(legs.size(), Distance(0));
+	parallelScan(pool, legs.begin(), legs.end(), running.begin(), std::plus<Distance>(), 100);
+
+	std::cout << "Reduce total: " << total.meters << " (expected 50005000)" << std::endl;
+	std::cout << "Scan last: " << running.back().meters << " (expected 50005000)" << std::endl;
+}
+
+void test_parallel_transform_scan() {
+	std::cout << "\n=== parallelTransform / parallelScan Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	std::vector<int> input(250000);
+	std::iota(input.begin(), input.end(), 0);
+
+	std::vector<long> squared(input.size());
+	parallelTransform(pool, input.begin(), input.end(), squared.begin(), [](int v) { return static_cast<long>(v) * v; });
+
+	std::vector<long> scanned(input.size());
+	std::vector<long> expected(input.size());
+	parallelScan(pool, squared.begin(), squared.end(), scanned.begin());
+	std::partial_sum(squared.begin(), squared.end(), expected.begin());
+
+	std::cout << "Transform matches: " << std::boolalpha << (squared[1234] == 1234L * 1234L) << std::endl;
+	std::cout << "Scan matches std::partial_sum: " << (scanned == expected) << std::endl;
+}
+
+void test_parallel_sort() {
+	std::cout << "\n=== parallelSort Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	std::mt19937 generator(42);
+	std::vector<int> values(500000);
+	for (auto &value : values)
+		value = static_cast<int>(generator());
+
+	std::vector<int> expected = values;
+	std::sort(expected.begin(), expected.end());
+
+	parallelSort(pool, values.begin(), values.end());
+	std::cout << "Ascending sort matches std::sort: " << std::boolalpha << (values == expected) << std::endl;
+
+	parallelSort(pool, values.begin(), values.end(), std::greater<int>(), 10000);
+	std::cout << "Descending sort is sorted: " << std::is_sorted(values.begin(), values.end(), std::greater<int>()) << std::endl;
+}
+
+void test_exceptions_and_wait_all() {
+	std::cout << "\n=== Exceptions and waitAll Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	try {
+		parallelFor(pool, 0, 1000, 10, [](int i) {
+			if (i == 500)
+				throw std::runtime_error("element 500 failed");
+		});
+	} catch (const std::runtime_error &e) {
+		std::cout << "Caught: " << e.what() << std::endl;
+	}
+
+	std::atomic<int> done{0};
+	for (int i = 0; i < 200; ++i) {
+		pool.addJob([&done]() {
+			std::this_thread::sleep_for(std::chrono::microseconds(200));
+			done.fetch_add(1);
+		});
+	}
+	pool.waitAll();
+	std::cout << "Jobs done after waitAll: " << done.load() << "/200" << std::endl;
+}
+
+int main() {
+	test_parallel_for();
+	test_parallel_reduce();
+	test_no_default_constructor();
+	test_parallel_transform_scan();
+	test_parallel_sort();
+	test_exceptions_and_wait_all();
+
+	return 0;
+}
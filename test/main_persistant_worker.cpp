@@ -3,6 +3,9 @@
 #include <atomic>
 #include <chrono>
 #include <random>
+#include <vector>
+#include <thread>
+#include <string>
 
 // Global counters for testing
 std::atomic<int> task1Counter{0};
@@ -409,6 +412,97 @@ void test_task_lifecycle() {
 	std::cout << "Task lifecycle test completed\n";
 }
 
+void test_concurrent_mutations() {
+	std::cout << "\n=== Concurrent Mutations Test ===\n";
+
+	PersistentWorker worker;
+	std::atomic<int> runs{0};
+	std::atomic<bool> selfRemoved{false};
+
+	// A task may remove itself while the worker is iterating its snapshot
+	worker.addTask("SelfRemoving", [&worker, &selfRemoved]() {
+		worker.removeTask("SelfRemoving");
+		selfRemoved.store(true);
+	});
+
+	std::vector<std::thread> mutators;
+	for (int t = 0; t < 4; ++t) {
+		mutators.emplace_back([&worker, &runs, t]() {
+			for (int i = 0; i < 500; ++i) {
+				std::string name = "task-" + std::to_string(t) + "-" + std::to_string(i % 20);
+				worker.addTask(name, [&runs]() { runs.fetch_add(1); });
+				if (i % 3 == 0)
+					worker.removeTask(name);
+			}
+		});
+	}
+	for (auto &mutator : mutators)
+		mutator.join();
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(300));
+	std::cout << "Self-removing task ran: " << (selfRemoved.load() ? "yes" : "no") << "\n";
+	std::cout << "Tasks ran during mutations: " << (runs.load() > 0 ? "yes" : "no") << "\n";
+}
+
+void test_task_periods() {
+	std::cout << "\n=== Task Periods Test ===\n";
+	PersistentWorker worker;
+	std::atomic<int> fast{0};
+	std::atomic<int> slow{0};
+
+	worker.addTask("fast", std::chrono::milliseconds(5), [&]() { fast++; });
+	worker.addTask("slow", std::chrono::milliseconds(100), [&]() { slow++; });
+	std::this_thread::sleep_for(std::chrono::milliseconds(320));
+
+	PersistentWorker::TaskStats fastStats = worker.getStats("fast");
+	PersistentWorker::TaskStats slowStats = worker.getStats("slow");
+	std::cout << "Fast task ran ~64 times: " << (fastStats.runs >= 40 && fastStats.runs <= 70 ? "yes" : "no") << "\n";
+	std::cout << "Slow task ran ~4 times: " << (slowStats.runs >= 3 && slowStats.runs <= 5 ? "yes" : "no") << "\n";
+	std::cout << "Periods reported: " << (fastStats.period == std::chrono::milliseconds(5) && slowStats.period == std::chrono::milliseconds(100) ? "yes" : "no") << "\n";
+
+	bool threw = false;
+	try {
+		worker.addTask("zero", std::chrono::milliseconds(0), []() {});
+	} catch (const std::runtime_error &) {
+		threw = true;
+	}
+	std::cout << "Zero period rejected: " << (threw ? "yes" : "no") << "\n";
+
+	threw = false;
+	try {
+		worker.getStats("missing");
+	} catch (const std::runtime_error &) {
+		threw = true;
+	}
+	std::cout << "Unknown task stats rejected: " << (threw ? "yes" : "no") << "\n";
+}
+
+void test_overruns_and_wakeup() {
+	std::cout << "\n=== Overrun And Wake-Up Test ===\n";
+	PersistentWorker worker;
+	std::atomic<bool> ran{false};
+
+	worker.addTask("overrun", std::chrono::milliseconds(10), []() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(25));
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	PersistentWorker::TaskStats stats = worker.getStats("overrun");
+	std::cout << "Overruns counted: " << (stats.overruns > 0 ? "yes" : "no") << "\n";
+	std::cout << "Runs not back to back: " << (stats.runs <= 8 ? "yes" : "no") << "\n";
+	std::cout << "Duration measured: " << (stats.meanDuration >= std::chrono::milliseconds(20) ? "yes" : "no") << "\n";
+	worker.removeTask("overrun");
+
+	// The worker is sleeping towards a far deadline; a new task must wake it
+	worker.addTask("idle", std::chrono::seconds(10), []() {});
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	auto added = std::chrono::steady_clock::now();
+	worker.addTask("wake", std::chrono::seconds(10), [&]() { ran = true; });
+	while (!ran.load() && std::chrono::steady_clock::now() - added < std::chrono::seconds(1))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	std::cout << "New task ran promptly: " << (ran.load() && std::chrono::steady_clock::now() - added < std::chrono::milliseconds(100) ? "yes" : "no") << "\n";
+	std::cout << "Jitter small on idle worker: " << (worker.getStats("wake").maxJitter < std::chrono::milliseconds(20) ? "yes" : "no") << "\n";
+}
+
 int main() {
 	std::cout << "Starting comprehensive PersistentWorker testing...\n";
 	
@@ -423,6 +517,9 @@ int main() {
 	test_multiple_workers();
 	test_stress_test();
 	test_task_lifecycle();
+	test_concurrent_mutations();
+	test_task_periods();
+	test_overruns_and_wakeup();
 	
 	std::cout << "\nAll PersistentWorker tests completed!\n";
 	return 0;
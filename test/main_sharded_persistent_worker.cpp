@@ -0,0 +1,135 @@
+#include "../libftpp.hpp"
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+void test_placement() {
+	std::cout << "\n=== Placement Test ===\n";
+	ShardedPersistentWorker worker(4);
+	std::atomic<int> runs{0};
+
+	for (int i = 0; i < 32; ++i)
+		worker.addTask("task" + std::to_string(i), std::chrono::milliseconds(10), [&]() { runs++; });
+	worker.addTask("pinned", std::chrono::milliseconds(10), [&]() { runs++; }, 2);
+
+	std::vector<int> perShard(worker.shardCount(), 0);
+	for (int i = 0; i < 32; ++i)
+		perShard[worker.shardOf("task" + std::to_string(i))]++;
+	bool spread = true;
+	for (int count : perShard)
+		spread = spread && count > 0;
+
+	std::cout << "Shard count: " << worker.shardCount() << "\n";
+	std::cout << "Hashed tasks spread over every shard: " << (spread ? "yes" : "no") << "\n";
+	std::cout << "Explicit placement honoured: " << (worker.shardOf("pinned") == 2 ? "yes" : "no") << "\n";
+	std::cout << "Task count: " << worker.taskCount() << "\n";
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	std::cout << "Tasks running: " << (runs.load() > 33 ? "yes" : "no") << "\n";
+
+	worker.removeTask("pinned");
+	std::cout << "Removed task gone: " << (!worker.hasTask("pinned") ? "yes" : "no") << "\n";
+
+	bool threw = false;
+	try {
+		worker.addTask("bad", std::chrono::milliseconds(10), []() {}, 4);
+	} catch (const std::runtime_error &) {
+		threw = true;
+	}
+	std::cout << "Out of range shard rejected: " << (threw ? "yes" : "no") << "\n";
+}
+
+void test_slow_task_isolation() {
+	std::cout << "\n=== Slow Task Isolation Test ===\n";
+	ShardedPersistentWorker worker(2);
+
+	worker.addTask("slow", std::chrono::milliseconds(10), []() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	}, 0);
+	worker.addTask("fast", std::chrono::milliseconds(5), []() {}, 1);
+	std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+	ShardedPersistentWorker::TaskStats fast = worker.getStats("fast");
+	std::cout << "Fast task keeps its cadence: " << (fast.runs >= 40 ? "yes" : "no") << "\n";
+	std::cout << "Fast task jitter unaffected: " << (fast.maxJitter < std::chrono::milliseconds(20) ? "yes" : "no") << "\n";
+}
+
+// Names that hash onto shard 0 of a two-shard worker
+static std::vector<std::string> namesOnFirstShard(size_t count) {
+	std::vector<std::string> names;
+
+	for (int i = 0; names.size() < count; ++i) {
+		std::string name = "task" + std::to_string(i);
+		if (std::hash<std::string>()(name) % 2 == 0)
+			names.push_back(name);
+	}
+	return names;
+}
+
+void test_rebalance() {
+	std::cout << "\n=== Rebalance Test ===\n";
+	ShardedPersistentWorker worker(2);
+	std::vector<std::string> names = namesOnFirstShard(4);
+
+	for (const std::string &name : names) {
+		worker.addTask(name, std::chrono::milliseconds(20), []() {
+			std::this_thread::sleep_for(std::chrono::milliseconds(3));
+		});
+	}
+	std::cout << "All tasks start on shard 0: " << (worker.shardOf(names[0]) == 0 && worker.shardOf(names[3]) == 0 ? "yes" : "no") << "\n";
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	size_t moved = worker.rebalance();
+	std::vector<int> perShard(2, 0);
+	for (const std::string &name : names)
+		perShard[worker.shardOf(name)]++;
+	std::cout << "Moved two tasks: " << (moved == 2 ? "yes" : "no") << "\n";
+	std::cout << "Rebalanced evenly: " << (perShard[0] == 2 && perShard[1] == 2 ? "yes" : "no") << "\n";
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	std::cout << "Second rebalance is stable: " << (worker.rebalance() == 0 ? "yes" : "no") << "\n";
+	std::cout << "Moved task keeps running: " << (worker.getStats(names[3]).runs > 0 ? "yes" : "no") << "\n";
+}
+
+void test_single_execution() {
+	std::cout << "\n=== Single Execution Test ===\n";
+	ShardedPersistentWorker worker(2);
+	std::vector<std::string> names = namesOnFirstShard(2);
+	std::atomic<int> inFlight{0};
+	std::atomic<bool> overlapped{false};
+	std::atomic<int> runs{0};
+
+	// The heavier task stays, so the almost always running one is moved
+	worker.addTask(names[0], std::chrono::milliseconds(1), []() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	});
+	worker.addTask(names[1], std::chrono::milliseconds(1), [&]() {
+		if (inFlight.fetch_add(1) != 0)
+			overlapped = true;
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		inFlight.fetch_sub(1);
+		runs++;
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	size_t moved = worker.rebalance();
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	std::cout << "Running task moved: " << (moved == 1 && worker.shardOf(names[1]) == 1 ? "yes" : "no") << "\n";
+	std::cout << "Task kept running: " << (runs.load() > 0 ? "yes" : "no") << "\n";
+	std::cout << "Never ran concurrently: " << (!overlapped.load() ? "yes" : "no") << "\n";
+}
+
+int main() {
+	std::cout << "Starting ShardedPersistentWorker testing...\n";
+
+	test_placement();
+	test_slow_task_isolation();
+	test_rebalance();
+	test_single_execution();
+
+	std::cout << "\nAll ShardedPersistentWorker tests completed!\n";
+	return 0;
+}
@@ -0,0 +1,199 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <system_error>
+#include <cerrno>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "../libftpp.hpp"
+
+#if LIBFTPP_COROUTINES
+
+Task<int> square(int value) {
+	co_return value * value;
+}
+
+Task<int> sumOfSquares(int count) {
+	int total = 0;
+	for (int i = 1; i <= count; ++i)
+		total += co_await square(i);
+	co_return total;
+}
+
+Task<void> failing() {
+	throw std::runtime_error("task failed");
+	co_return;
+}
+
+void test_nested_tasks(WorkerPool &pool) {
+	std::cout << "\n=== Nested Tasks Test ===" << std::endl;
+
+	std::cout << "Sum of squares 1..10: " << spawn(pool, sumOfSquares(10)).get() << std::endl;
+
+	try {
+		spawn(pool, failing()).get();
+	} catch (const std::exception &e) {
+		std::cout << "Exception propagated: " << e.what() << std::endl;
+	}
+}
+
+Task<bool> hopToPool(WorkerPool &pool) {
+	co_await pool.schedule();
+	co_return pool.isWorkerThread();
+}
+
+Task<long> sleeper(WorkerPool &pool, std::chrono::milliseconds delay) {
+	auto start = std::chrono::steady_clock::now();
+	co_await pool.sleepFor(delay);
+	co_return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+void test_pool_awaitables(WorkerPool &pool) {
+	std::cout << "\n=== Pool Awaitables Test ===" << std::endl;
+
+	std::cout << "Resumed on a worker after schedule(): " << (spawn(pool, hopToPool(pool)).get() ? "yes" : "no") << std::endl;
+	std::cout << "sleepFor(30ms) waited >= 30ms: " << (spawn(pool, sleeper(pool, std::chrono::milliseconds(30))).get() >= 30 ? "yes" : "no") << std::endl;
+
+	// Many more sleeping coroutines than threads
+	std::vector<Future<long>> sleepers;
+	for (int i = 0; i < 10000; ++i)
+		sleepers.push_back(spawn(pool, sleeper(pool, std::chrono::milliseconds(20))));
+	int finished = 0;
+	for (auto &future : sleepers)
+		finished += future.get() >= 20;
+	std::cout << "Concurrent sleepers finished: " << finished << "/10000 on " << pool.size() << " workers" << std::endl;
+}
+
+Task<std::string> awaitFuture(WorkerPool &pool) {
+	Future<int> answer = pool.submit([]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		return 42;
+	});
+	int value = co_await answer;
+	Promise<std::string> promise;
+	Future<std::string> later = promise.getFuture();
+	std::thread([promise = std::move(promise)]() mutable {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		promise.setValue(std::string("from another thread"));
+	}).detach();
+	co_return std::to_string(value) + " / " + co_await std::move(later);
+}
+
+void test_future_awaitable(WorkerPool &pool) {
+	std::cout << "\n=== Future Awaitable Test ===" << std::endl;
+
+	std::cout << "Awaited: " << spawn(pool, awaitFuture(pool)).get() << std::endl;
+}
+
+Task<std::string> echoOnce(IoReactor &reactor, int fd) {
+	char buffer[64];
+
+	co_await reactor.readable(fd);
+	ssize_t received = ::recv(fd, buffer, sizeof(buffer), 0);
+	co_await reactor.writable(fd);
+	::send(fd, buffer, static_cast<size_t>(received), 0);
+	co_return std::string(buffer, static_cast<size_t>(received));
+}
+
+void test_socket_awaitables(WorkerPool &pool) {
+	std::cout << "\n=== Socket Awaitables Test ===" << std::endl;
+
+	IoReactor reactor(pool);
+	int sockets[2];
+	socketpair(AF_UNIX, SOCK_STREAM, 0, sockets);
+
+	Future<std::string> echoed = spawn(pool, echoOnce(reactor, sockets[1]));
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	::send(sockets[0], "ping", 4, 0);
+
+	char reply[8] = {0};
+	::recv(sockets[0], reply, sizeof(reply), 0);
+	std::cout << "Server side read: " << echoed.get() << ", client got echo: " << reply << std::endl;
+
+	close(sockets[0]);
+	close(sockets[1]);
+}
+
+Task<int> waitForever(IoReactor &reactor, int fd) {
+	try {
+		co_await reactor.readable(fd);
+	} catch (const std::system_error &e) {
+		co_return e.code().value();
+	}
+	co_return 0;
+}
+
+void test_reactor_destroyed(WorkerPool &pool) {
+	std::cout << "\n=== Reactor Destroyed Test ===" << std::endl;
+
+	int sockets[2];
+	socketpair(AF_UNIX, SOCK_STREAM, 0, sockets);
+
+	Future<int> waiting;
+	{
+		IoReactor reactor(pool);
+		waiting = spawn(pool, waitForever(reactor, sockets[1]));
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+		while (reactor.watched() == 0 && std::chrono::steady_clock::now() < deadline)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	std::cout << "Waiting coroutine resumed with ECANCELED: " << (waiting.get() == ECANCELED ? "yes" : "no") << std::endl;
+
+	close(sockets[0]);
+	close(sockets[1]);
+}
+
+Task<int> sleepThenAnswer(WorkerPool &pool) {
+	co_await pool.sleepFor(std::chrono::seconds(5));
+	co_return 42;
+}
+
+void test_pool_destroyed() {
+	std::cout << "\n=== Pool Destroyed Test ===" << std::endl;
+
+	Future<int> sleeping;
+	auto start = std::chrono::steady_clock::now();
+	{
+		WorkerPool pool(2);
+		sleeping = spawn(pool, sleepThenAnswer(pool));
+		auto deadline = start + std::chrono::seconds(2);
+		while (pool.pendingTimers() == 0 && std::chrono::steady_clock::now() < deadline)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	int code = 0;
+	try {
+		sleeping.get();
+	} catch (const std::system_error &e) {
+		code = e.code().value();
+	}
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << "Sleeping task failed with ECANCELED: " << (code == ECANCELED ? "yes" : "no") << std::endl;
+	std::cout << "Did not wait for the timer: " << (elapsed < std::chrono::seconds(4) ? "yes" : "no") << std::endl;
+}
+
+int main() {
+	WorkerPool pool(4);
+
+	test_nested_tasks(pool);
+	test_pool_awaitables(pool);
+	test_future_awaitable(pool);
+	test_socket_awaitables(pool);
+	test_reactor_destroyed(pool);
+	test_pool_destroyed();
+
+	std::cout << "\nAll Task tests completed!" << std::endl;
+	return 0;
+}
+
+#else
+
+int main() {
+	std::cout << "Coroutine support requires C++20 (make CXXSTD=c++20)" << std::endl;
+	return 0;
+}
+
+#endif
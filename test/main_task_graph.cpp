@@ -0,0 +1,137 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <mutex>
+#include "../libftpp.hpp"
+
+void test_dependency_order() {
+	std::cout << "\n=== Dependency Order Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	TaskGraph graph;
+	std::mutex orderMutex;
+	std::vector<std::string> order;
+
+	auto record = [&order, &orderMutex](const std::string &name) {
+		return [&order, &orderMutex, name]() {
+			std::lock_guard<std::mutex> lock(orderMutex);
+			order.push_back(name);
+		};
+	};
+
+	TaskGraph::NodeId decode = graph.addNode("decode", record("decode"));
+	TaskGraph::NodeId update = graph.addNode("update", record("update"));
+	TaskGraph::NodeId snapshot = graph.addNode("snapshot", record("snapshot"));
+	TaskGraph::NodeId broadcast = graph.addNode("broadcast", record("broadcast"));
+
+	graph.addDependency(update, decode);
+	graph.addDependency(snapshot, update);
+	graph.addDependency(broadcast, snapshot);
+
+	graph.runAndWait(pool);
+
+	std::cout << "Execution order:";
+	for (const auto &name : order)
+		std::cout << " " << name;
+	std::cout << std::endl;
+}
+
+void test_fan_out_fan_in() {
+	std::cout << "\n=== Fan-out / Fan-in Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	TaskGraph graph;
+	std::atomic<int> updated{0};
+	int observed = -1;
+
+	TaskGraph::NodeId source = graph.addNode("decode", []() {});
+	TaskGraph::NodeId sink = graph.addNode("broadcast", [&updated, &observed]() { observed = updated.load(); });
+	for (int i = 0; i < 16; ++i) {
+		TaskGraph::NodeId node = graph.addNode("update-" + std::to_string(i), [&updated]() { updated.fetch_add(1); });
+		graph.addDependency(node, source);
+		graph.addDependency(sink, node);
+	}
+
+	graph.runAndWait(pool);
+	std::cout << "Broadcast saw " << observed << "/16 updates" << std::endl;
+}
+
+void test_reuse_across_frames() {
+	std::cout << "\n=== Reuse Across Frames Test ===" << std::endl;
+
+	WorkerPool pool(4);
+	TaskGraph graph;
+	std::atomic<int> runs{0};
+
+	TaskGraph::NodeId a = graph.addNode("a", [&runs]() { runs.fetch_add(1); });
+	TaskGraph::NodeId b = graph.addNode("b", [&runs]() { runs.fetch_add(1); });
+	TaskGraph::NodeId c = graph.addNode("c", [&runs]() { runs.fetch_add(1); });
+	graph.addDependency(c, a);
+	graph.addDependency(c, b);
+
+	for (int frame = 0; frame < 100; ++frame)
+		graph.runAndWait(pool);
+
+	std::cout << "Node executions over 100 frames: " << runs.load() << "/300" << std::endl;
+}
+
+void test_cycle_and_errors() {
+	std::cout << "\n=== Cycle and Error Test ===" << std::endl;
+
+	WorkerPool pool(2);
+	TaskGraph cyclic;
+	TaskGraph::NodeId a = cyclic.addNode("a", []() {});
+	TaskGraph::NodeId b = cyclic.addNode("b", []() {});
+	cyclic.addDependency(b, a);
+	cyclic.addDependency(a, b);
+	try {
+		cyclic.run(pool);
+	} catch (const std::runtime_error &e) {
+		std::cout << "Cycle detected: " << e.what() << std::endl;
+	}
+
+	TaskGraph failing;
+	bool downstreamRan = false;
+	TaskGraph::NodeId first = failing.addNode("first", []() { throw std::runtime_error("decode failed"); });
+	TaskGraph::NodeId second = failing.addNode("second", [&downstreamRan]() { downstreamRan = true; });
+	failing.addDependency(second, first);
+	try {
+		failing.runAndWait(pool);
+	} catch (const std::runtime_error &e) {
+		std::cout << "Caught: " << e.what() << ", downstream ran: " << std::boolalpha << downstreamRan << std::endl;
+	}
+}
+
+void test_pool_shutdown() {
+	std::cout << "\n=== Pool Shutdown Test ===" << std::endl;
+
+	TaskGraph graph;
+	std::atomic<int> runs(0);
+	TaskGraph::NodeId root = graph.addNode("root", [&runs]() { runs++; });
+	for (int i = 0; i < 4; i++)
+		graph.addDependency(graph.addNode("leaf", [&runs]() { runs++; }), root);
+	{
+		// The single worker is busy while the pool is destroyed
+		WorkerPool pool(1);
+		pool.addJob([]() { std::this_thread::sleep_for(std::chrono::milliseconds(100)); });
+		graph.run(pool);
+	}
+	try {
+		graph.wait();
+		std::cout << "Dropped nodes fail the run: no" << std::endl;
+	} catch (const std::future_error &e) {
+		std::cout << "Dropped nodes fail the run: " << (e.code() == std::future_errc::broken_promise ? "yes" : "no")
+				  << ", nodes ran: " << runs.load() << std::endl;
+	}
+}
+
+int main() {
+	test_dependency_order();
+	test_fan_out_fan_in();
+	test_reuse_across_frames();
+	test_cycle_and_errors();
+	test_pool_shutdown();
+
+	return 0;
+}
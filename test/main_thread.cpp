@@ -874,6 +874,38 @@ void test_concurrent_status_queries() {
 	threadSafeCout << "Concurrent status queries test completed" << std::endl;
 }
 
+void test_thread_attributes() {
+	threadSafeCout << "\n=== Thread Attributes Test ===" << std::endl;
+
+	std::vector<int> cpus = ThreadAttributes::availableCpus();
+	ThreadAttributes attributes;
+	attributes.cpus = {cpus.front()};
+	attributes.adjustNice = true;
+	attributes.nice = 5;
+
+	std::string osName;
+	std::vector<int> affinity;
+	Thread pinned("PinnedWorker", [&]() {
+		osName = ThreadAttributes::currentName();
+		affinity = ThreadAttributes::currentAffinity();
+	}, attributes);
+	pinned.start();
+	pinned.stop();
+
+	threadSafeCout << "OS thread name: " << osName << std::endl;
+	threadSafeCout << "Pinned to requested CPU: " << (affinity == attributes.cpus ? "yes" : "no") << std::endl;
+
+	ThreadAttributes invalid;
+	invalid.cpus = {-1};
+	Thread broken("Broken", []() {}, invalid);
+	try {
+		broken.start();
+	} catch (const std::exception &e) {
+		threadSafeCout << "Invalid placement rejected: " << e.what() << std::endl;
+	}
+	threadSafeCout << "Broken thread running: " << (broken.isRunning() ? "yes" : "no") << std::endl;
+}
+
 // Update your main function to include the new tests:
 int main() {
 	threadSafeCout << "Starting comprehensive thread testing..." << std::endl;
@@ -898,6 +930,7 @@ int main() {
 	test_thread_ids();
 	test_lifecycle_state_changes();
 	test_concurrent_status_queries();
+	test_thread_attributes();
 	
 	threadSafeCout << "\nAll thread tests completed!" << std::endl;
 	threadSafeCout << "Final global counter value: " << globalCounter.load() << std::endl;
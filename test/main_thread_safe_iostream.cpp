@@ -3,6 +3,12 @@
 #include <vector>
 #include <chrono>
 #include <sstream>
+#include <limits>
+#include <string_view>
+#include <regex>
+#include <cstdio>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "../libftpp.hpp"
 
 // Original test - kept as is
@@ -215,6 +221,258 @@ void runPromptTest() {
 	}
 }
 
+// Formats value through threadSafeCout with std::cout captured, and checks it
+// matches what a default std::ostream produces
+template <typename T>
+bool formatsLikeOstream(const T &value) {
+	std::ostringstream expected;
+	std::ostringstream captured;
+	expected << value;
+
+	ThreadSafeIOStream::flush();
+	std::streambuf *previous = std::cout.rdbuf(captured.rdbuf());
+	threadSafeCout << value << std::flush;
+	ThreadSafeIOStream::flush();
+	std::cout.rdbuf(previous);
+	return captured.str() == expected.str();
+}
+
+void runFormattingTest() {
+	std::cout << "\n=== FORMATTING TEST ===\n" << std::endl;
+
+	bool ok = true;
+	ok = formatsLikeOstream(0) && ok;
+	ok = formatsLikeOstream(-42) && ok;
+	ok = formatsLikeOstream(std::numeric_limits<long long>::min()) && ok;
+	ok = formatsLikeOstream(std::numeric_limits<unsigned long>::max()) && ok;
+	ok = formatsLikeOstream(static_cast<short>(-7)) && ok;
+	std::cout << "Integers: " << (ok ? "yes" : "no") << std::endl;
+
+	ok = true;
+	for (double value : {0.0, -0.0, 1.0, 0.1, 3.14159265, 1e-7, 123456.0, 1234567.0, 1e300, -2.5e-300,
+						 std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()})
+		ok = formatsLikeOstream(value) && ok;
+	ok = formatsLikeOstream(3.14f * 3) && ok;
+	ok = formatsLikeOstream(1.0L / 3) && ok;
+	std::cout << "Floating point: " << (ok ? "yes" : "no") << std::endl;
+
+	ok = formatsLikeOstream(true) && formatsLikeOstream(false);
+	std::cout << "Bools: " << (ok ? "yes" : "no") << std::endl;
+
+	ok = formatsLikeOstream('A') && formatsLikeOstream(static_cast<signed char>('b'))
+		 && formatsLikeOstream(static_cast<unsigned char>('c'));
+	std::cout << "Characters: " << (ok ? "yes" : "no") << std::endl;
+
+	const char *cstring = "c string";
+	std::string string = "std::string";
+	ok = formatsLikeOstream("literal") && formatsLikeOstream(cstring) && formatsLikeOstream(string)
+		 && formatsLikeOstream(std::string_view("view"));
+	std::cout << "Strings: " << (ok ? "yes" : "no") << std::endl;
+
+	int local = 0;
+	ok = formatsLikeOstream(&local) && formatsLikeOstream(std::chrono::seconds(3).count());
+	std::cout << "Fallback types: " << (ok ? "yes" : "no") << std::endl;
+
+	std::ostringstream captured;
+	ThreadSafeIOStream::flush();
+	std::streambuf *previous = std::cout.rdbuf(captured.rdbuf());
+	threadSafeCout.setPrefix("[P] ");
+	threadSafeCout << "one\ntwo\n\nfour" << std::endl;
+	threadSafeCout << "five\n" << std::flush;
+	threadSafeCout.setPrefix("");
+	ThreadSafeIOStream::flush();
+	std::cout.rdbuf(previous);
+	std::cout << "Prefix on every line: " << (captured.str() == "[P] one\n[P] two\n[P] \n[P] four\n[P] five\n" ? "yes" : "no") << std::endl;
+
+	captured.str("");
+	ThreadSafeIOStream::flush();
+	previous = std::cout.rdbuf(captured.rdbuf());
+	threadSafeCout.setPrefix("[P] ");
+	threadSafeCout.setTimestamped(true);
+	threadSafeCout << "one\ntwo" << std::endl;
+	threadSafeCout.setTimestamped(false);
+	threadSafeCout.setPrefix("");
+	ThreadSafeIOStream::flush();
+	std::cout.rdbuf(previous);
+	std::regex stamped("\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}\\.\\d{3} \\[P\\] one\n"
+					   "\\d{4}-\\d{2}-\\d{2} \\d{2}:\\d{2}:\\d{2}\\.\\d{3} \\[P\\] two\n");
+	std::cout << "Timestamp before the prefix: " << (std::regex_match(captured.str(), stamped) ? "yes" : "no") << std::endl;
+}
+
+// Points file descriptor 1 at a temporary file for the duration of body
+template <typename TFunction>
+std::string captureStdout(TFunction body) {
+	ThreadSafeIOStream::flush();
+	FILE *file = std::tmpfile();
+	int saved = dup(STDOUT_FILENO);
+	dup2(fileno(file), STDOUT_FILENO);
+
+	body();
+
+	ThreadSafeIOStream::flush();
+	dup2(saved, STDOUT_FILENO);
+	close(saved);
+
+	std::string content;
+	char chunk[4096];
+	size_t got;
+	std::rewind(file);
+	while ((got = std::fread(chunk, 1, sizeof(chunk), file)) > 0)
+		content.append(chunk, got);
+	std::fclose(file);
+	return content;
+}
+
+void runAsyncOutputTest() {
+	std::cout << "\n=== ASYNC OUTPUT TEST ===\n" << std::endl;
+	const int threadCount = 4;
+	const int lines = 2000;
+	bool flushedEarly = false;
+
+	std::string output = captureStdout([&]() {
+		ThreadSafeIOStream::setOutputMode(ThreadSafeIOStream::OutputMode::ASYNC);
+		std::vector<std::thread> threads;
+		for (int t = 0; t < threadCount; ++t) {
+			threads.emplace_back([t]() {
+				threadSafeCout.setPrefix("[A" + std::to_string(t) + "] ");
+				for (int i = 0; i < lines; ++i)
+					threadSafeCout << "line " << i << " of thread " << t << std::endl;
+			});
+		}
+		for (auto &thread : threads)
+			thread.join();
+
+		threadSafeCout << "marker" << std::endl;
+		ThreadSafeIOStream::flush();
+		struct stat info;
+		fstat(STDOUT_FILENO, &info);
+		flushedEarly = info.st_size > 0 && static_cast<size_t>(info.st_size) >= threadCount * lines * 20u;
+		ThreadSafeIOStream::setOutputMode(ThreadSafeIOStream::OutputMode::SYNC);
+	});
+
+	std::istringstream stream(output);
+	std::string line;
+	std::vector<int> next(threadCount, 0);
+	bool intact = true;
+	int count = 0;
+	while (std::getline(stream, line)) {
+		if (line == "marker")
+			continue;
+		int thread = -1;
+		int index = -1;
+		int owner = -1;
+		if (std::sscanf(line.c_str(), "[A%d] line %d of thread %d", &thread, &index, &owner) != 3
+			|| thread != owner || thread < 0 || thread >= threadCount) {
+			intact = false;
+			continue;
+		}
+		if (index != next[thread])
+			intact = false;
+		next[thread] = index + 1;
+		++count;
+	}
+	std::cout << "Mode restored to SYNC: " << (ThreadSafeIOStream::getOutputMode() == ThreadSafeIOStream::OutputMode::SYNC ? "yes" : "no") << std::endl;
+	std::cout << "All lines written: " << (count == threadCount * lines ? "yes" : "no") << std::endl;
+	std::cout << "Lines whole and in per-thread order: " << (intact ? "yes" : "no") << std::endl;
+	std::cout << "Flush waited for the writer: " << (flushedEarly ? "yes" : "no") << std::endl;
+	std::cout << "Marker written last: " << (output.size() >= 7 && output.compare(output.size() - 7, 7, "marker\n") == 0 ? "yes" : "no") << std::endl;
+}
+
+static off_t stdoutSize() {
+	struct stat info;
+	fstat(STDOUT_FILENO, &info);
+	return info.st_size;
+}
+
+void runFlushPolicyTest() {
+	std::cout << "\n=== FLUSH POLICY TEST ===\n" << std::endl;
+	using Policy = ThreadSafeIOStream::FlushPolicy;
+	using Mode = ThreadSafeIOStream::FlushMode;
+	Policy original = ThreadSafeIOStream::getFlushPolicy();
+	bool lineDefault = original.mode == Mode::LINE;
+	bool fileSuggestion = false;
+	bool flushWrites = false;
+	std::string interleaved;
+	bool lineImmediate = false;
+	bool sizeHeld = false;
+	bool sizeWritten = false;
+	bool intervalHeld = false;
+	bool intervalWritten = false;
+	bool exitHeld = false;
+	bool exitWritten = false;
+
+	interleaved = captureStdout([]() {
+		threadSafeCout << "first" << std::endl;
+		std::cout << "second" << std::endl;
+		threadSafeCout << "third" << std::endl;
+	});
+
+	std::string output = captureStdout([&]() {
+		fileSuggestion = ThreadSafeIOStream::stdoutFlushPolicy().mode == Mode::SIZE;
+
+		Policy policy;
+		policy.mode = Mode::LINE;
+		ThreadSafeIOStream::setFlushPolicy(policy);
+		threadSafeCout << "line" << std::endl;
+		lineImmediate = stdoutSize() == 5;
+
+		policy.mode = Mode::SIZE;
+		policy.size = 64;
+		ThreadSafeIOStream::setFlushPolicy(policy);
+		for (int i = 0; i < 6; ++i)
+			threadSafeCout << "size " << i << std::endl;
+		sizeHeld = stdoutSize() == 5;
+		for (int i = 6; i < 12; ++i)
+			threadSafeCout << "size " << i << std::endl;
+		sizeWritten = stdoutSize() >= 5 + 64;
+		threadSafeCout << "flushed" << std::flush;
+		flushWrites = stdoutSize() == 5 + 86 + 7;
+		threadSafeCout << std::endl;
+
+		policy.mode = Mode::INTERVAL;
+		policy.interval = std::chrono::milliseconds(20);
+		ThreadSafeIOStream::setFlushPolicy(policy);
+		off_t before = stdoutSize();
+		threadSafeCout << "interval" << std::endl;
+		intervalHeld = stdoutSize() == before;
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		intervalWritten = stdoutSize() == before + 9;
+
+		policy.mode = Mode::EXIT;
+		ThreadSafeIOStream::setFlushPolicy(policy);
+		before = stdoutSize();
+		for (int i = 0; i < 1000; ++i)
+			threadSafeCout << "exit " << i << std::endl;
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		exitHeld = stdoutSize() == before;
+		ThreadSafeIOStream::flush();
+		exitWritten = stdoutSize() > before;
+	});
+	ThreadSafeIOStream::setFlushPolicy(original);
+
+	bool rejected = false;
+	try {
+		Policy invalid;
+		invalid.size = 0;
+		ThreadSafeIOStream::setFlushPolicy(invalid);
+	} catch (const std::runtime_error &) {
+		rejected = true;
+	}
+
+	std::cout << "Default policy is LINE: " << (lineDefault ? "yes" : "no") << std::endl;
+	std::cout << "Default keeps order with std::cout: " << (interleaved == "first\nsecond\nthird\n" ? "yes" : "no") << std::endl;
+	std::cout << "File stdout suggests SIZE: " << (fileSuggestion ? "yes" : "no") << std::endl;
+	std::cout << "std::flush writes buffered lines: " << (flushWrites ? "yes" : "no") << std::endl;
+	std::cout << "LINE writes every line: " << (lineImmediate ? "yes" : "no") << std::endl;
+	std::cout << "SIZE holds small output: " << (sizeHeld ? "yes" : "no") << std::endl;
+	std::cout << "SIZE writes at the threshold: " << (sizeWritten ? "yes" : "no") << std::endl;
+	std::cout << "INTERVAL holds a fresh line: " << (intervalHeld ? "yes" : "no") << std::endl;
+	std::cout << "INTERVAL writes it without new output: " << (intervalWritten ? "yes" : "no") << std::endl;
+	std::cout << "EXIT holds until flush: " << (exitHeld && exitWritten ? "yes" : "no") << std::endl;
+	std::cout << "Nothing lost: " << (output.find("exit 999\n") != std::string::npos && output.find("size 11\n") != std::string::npos ? "yes" : "no") << std::endl;
+	std::cout << "Zero size rejected: " << (rejected ? "yes" : "no") << std::endl;
+}
+
 int main() {
 	std::cout << "Starting ThreadSafeIOStream comprehensive tests...\n" << std::endl;
 	
@@ -228,6 +486,9 @@ int main() {
 	runChangingPrefixTest();
 	runSpecialCharactersTest();
 	runPromptTest();
+	runFormattingTest();
+	runAsyncOutputTest();
+	runFlushPolicyTest();
 	
 	std::cout << "\n=== ALL TESTS COMPLETED ===\n" << std::endl;
 	
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+#include <ctime>
+#include "../libftpp.hpp"
+
+using SystemClock = std::chrono::system_clock;
+
+// The slow reference: localtime_r and strftime on every call
+static std::string reference(SystemClock::time_point time, TimestampFormatter::Precision precision) {
+	int64_t micros = std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count();
+	int64_t second = micros / 1000000;
+	int64_t fraction = micros % 1000000;
+	if (fraction < 0) {
+		fraction += 1000000;
+		--second;
+	}
+	std::time_t seconds = static_cast<std::time_t>(second);
+	struct tm calendar;
+	char text[64];
+	localtime_r(&seconds, &calendar);
+	std::strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", &calendar);
+
+	std::string result(text);
+	if (precision == TimestampFormatter::Precision::MILLISECONDS)
+		std::snprintf(text, sizeof(text), ".%03lld", static_cast<long long>(fraction / 1000));
+	else if (precision == TimestampFormatter::Precision::MICROSECONDS)
+		std::snprintf(text, sizeof(text), ".%06lld", static_cast<long long>(fraction));
+	else
+		text[0] = '\0';
+	return result + text;
+}
+
+static SystemClock::time_point fromMicros(int64_t micros) {
+	return SystemClock::time_point(std::chrono::duration_cast<SystemClock::duration>(std::chrono::microseconds(micros)));
+}
+
+void test_matches_strftime() {
+	std::cout << "\n=== Matches strftime Test ===" << std::endl;
+
+	std::mt19937_64 random(42);
+	std::uniform_int_distribution<int64_t> spread(-2000000000000000ll, 4000000000000000ll);
+	const TimestampFormatter::Precision precisions[] = {TimestampFormatter::Precision::SECONDS,
+		TimestampFormatter::Precision::MILLISECONDS, TimestampFormatter::Precision::MICROSECONDS};
+
+	for (TimestampFormatter::Precision precision : precisions) {
+		TimestampFormatter formatter(precision);
+		bool same = true;
+		for (int i = 0; i < 20000; ++i) {
+			SystemClock::time_point time = fromMicros(spread(random));
+			std::string text;
+			formatter.append(text, time);
+			same = same && text == reference(time, precision);
+		}
+		std::cout << "Random times, " << reference(SystemClock::time_point(), precision).size() << " characters: "
+				  << (same ? "yes" : "no") << std::endl;
+	}
+
+	TimestampFormatter formatter(TimestampFormatter::Precision::MICROSECONDS);
+	bool before = true;
+	for (int64_t micros : {-1ll, -999999ll, -1000000ll, -1000001ll, 0ll, 999999ll}) {
+		std::string text;
+		formatter.append(text, fromMicros(micros));
+		before = before && text == reference(fromMicros(micros), TimestampFormatter::Precision::MICROSECONDS);
+	}
+	std::cout << "Times around the epoch: " << (before ? "yes" : "no") << std::endl;
+}
+
+void test_second_boundaries() {
+	std::cout << "\n=== Second Boundaries Test ===" << std::endl;
+
+	TimestampFormatter formatter;
+	int64_t start = std::chrono::duration_cast<std::chrono::microseconds>(SystemClock::now().time_since_epoch()).count();
+	bool same = true;
+	for (int64_t micros = start; micros < start + 5000000; micros += 997) {
+		std::string text;
+		formatter.append(text, fromMicros(micros));
+		same = same && text == reference(fromMicros(micros), TimestampFormatter::Precision::MILLISECONDS);
+	}
+	std::cout << "Consecutive times across seconds: " << (same ? "yes" : "no") << std::endl;
+
+	std::string text;
+	formatter.append(text, fromMicros(start + 5000000));
+	formatter.append(text, fromMicros(start));
+	std::cout << "Going back in time: " << (text == reference(fromMicros(start + 5000000), TimestampFormatter::Precision::MILLISECONDS)
+											  + reference(fromMicros(start), TimestampFormatter::Precision::MILLISECONDS) ? "yes" : "no") << std::endl;
+}
+
+void test_per_thread() {
+	std::cout << "\n=== Per-Thread Formatter Test ===" << std::endl;
+
+	const int threadCount = 4;
+	std::vector<std::thread> threads;
+	std::vector<TimestampFormatter *> owners(threadCount);
+	std::vector<bool> correct(threadCount, true);
+	for (int t = 0; t < threadCount; ++t) {
+		threads.emplace_back([&owners, &correct, t]() {
+			owners[t] = &TimestampFormatter::perThread();
+			for (int i = 0; i < 100000; ++i) {
+				SystemClock::time_point time = fromMicros(1700000000000000ll + t * 3600000000ll + i * 1013ll);
+				std::string text;
+				TimestampFormatter::perThread().append(text, time);
+				if (i % 97 == 0 && text != reference(time, TimestampFormatter::Precision::MILLISECONDS))
+					correct[t] = false;
+			}
+		});
+	}
+	for (auto &thread : threads)
+		thread.join();
+
+	bool distinct = true, allCorrect = true;
+	for (int t = 0; t < threadCount; ++t) {
+		allCorrect = allCorrect && correct[t];
+		for (int u = t + 1; u < threadCount; ++u)
+			distinct = distinct && owners[t] != owners[u];
+	}
+	std::cout << "One formatter per thread: " << (distinct ? "yes" : "no") << std::endl;
+	std::cout << "Concurrent threads format correctly: " << (allCorrect ? "yes" : "no") << std::endl;
+	std::cout << "Millisecond precision: " << (TimestampFormatter::perThread().precision() == TimestampFormatter::Precision::MILLISECONDS ? "yes" : "no") << std::endl;
+}
+
+int main() {
+	test_matches_strftime();
+	test_second_boundaries();
+	test_per_thread();
+	std::cout << "\n=== All TimestampFormatter Tests Completed ===" << std::endl;
+	return 0;
+}
@@ -0,0 +1,79 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include "../libftpp.hpp"
+
+void test_owner_lifo() {
+	std::cout << "\n=== Owner LIFO / Thief FIFO Test ===" << std::endl;
+
+	WorkStealingDeque<int> deque(4);
+	for (int i = 0; i < 10; ++i)
+		deque.push(i);
+
+	int value;
+	deque.steal(value);
+	std::cout << "Stolen (oldest): " << value << std::endl;
+	deque.take(value);
+	std::cout << "Taken (newest): " << value << std::endl;
+	std::cout << "Remaining size: " << deque.size() << std::endl;
+}
+
+void test_concurrent_steal() {
+	std::cout << "\n=== Concurrent Steal Test ===" << std::endl;
+
+	const int total = 200000;
+	WorkStealingDeque<int> deque;
+	std::vector<std::atomic<int>> seen(total);
+	std::atomic<bool> done{false};
+	std::atomic<int> stolen{0};
+
+	for (auto &s : seen)
+		s.store(0);
+
+	std::vector<std::thread> thieves;
+	for (int t = 0; t < 3; ++t) {
+		thieves.emplace_back([&]() {
+			int value;
+			while (!done.load() || !deque.empty()) {
+				if (deque.steal(value)) {
+					seen[value].fetch_add(1);
+					stolen.fetch_add(1);
+				}
+			}
+		});
+	}
+
+	// Owner interleaves pushes with its own takes
+	int value;
+	for (int i = 0; i < total; ++i) {
+		deque.push(i);
+		if (i % 3 == 0 && deque.take(value))
+			seen[value].fetch_add(1);
+	}
+	while (deque.take(value))
+		seen[value].fetch_add(1);
+	done.store(true);
+
+	for (auto &thief : thieves)
+		thief.join();
+
+	int duplicates = 0;
+	int missing = 0;
+	for (auto &s : seen) {
+		if (s.load() == 0)
+			missing++;
+		else if (s.load() > 1)
+			duplicates++;
+	}
+
+	std::cout << "Stolen by thieves: " << stolen.load() << std::endl;
+	std::cout << "Missing: " << missing << ", duplicates: " << duplicates << std::endl;
+}
+
+int main() {
+	test_owner_lifo();
+	test_concurrent_steal();
+
+	return 0;
+}
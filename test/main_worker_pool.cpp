@@ -1,5 +1,6 @@
 #include "../libftpp.hpp"
 #include <iostream>
+#include <set>
 #include <atomic>
 #include <chrono>
 #include <vector>
@@ -755,6 +756,219 @@ void test_performance_comparison() {
 	}
 }
 
+void test_idle_policies() {
+	std::cout << "\n=== Idle Policies Test ===" << std::endl;
+
+	for (auto policy : {WorkerPool::IdlePolicy::LATENCY, WorkerPool::IdlePolicy::CPU}) {
+		completedJobs.store(0);
+		WorkerPool::Config config;
+		config.idlePolicy = policy;
+		WorkerPool pool(4, config);
+
+		// Let the workers go idle and park before submitting
+		std::this_thread::sleep_for(std::chrono::milliseconds(200));
+		for (int i = 0; i < 100; ++i) {
+			pool.addJob([]() { completedJobs.fetch_add(1); });
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		while (completedJobs.load() < 100 && std::chrono::steady_clock::now() - start < std::chrono::seconds(2))
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		std::cout << (policy == WorkerPool::IdlePolicy::LATENCY ? "LATENCY" : "CPU")
+				  << " policy completed: " << completedJobs.load() << "/100 jobs after parking" << std::endl;
+	}
+}
+
+void spawnTree(WorkerPool &pool, int depth, std::atomic<int> &leaves) {
+	if (depth == 0) {
+		leaves.fetch_add(1);
+		return;
+	}
+	pool.addJob([&pool, depth, &leaves]() { spawnTree(pool, depth - 1, leaves); });
+	pool.addJob([&pool, depth, &leaves]() { spawnTree(pool, depth - 1, leaves); });
+}
+
+void test_nested_jobs() {
+	std::cout << "\n=== Nested Jobs (work stealing) Test ===" << std::endl;
+
+	std::atomic<int> leaves{0};
+	WorkerPool pool(4);
+
+	pool.addJob([&pool, &leaves]() { spawnTree(pool, 14, leaves); });
+
+	auto start = std::chrono::steady_clock::now();
+	while (leaves.load() < (1 << 14) && std::chrono::steady_clock::now() - start < std::chrono::seconds(5))
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	std::cout << "Leaves reached: " << leaves.load() << "/" << (1 << 14) << std::endl;
+}
+
+void test_elastic_pool() {
+	std::cout << "\n=== Elastic Pool Test ===" << std::endl;
+
+	WorkerPool::Config config;
+	config.minWorkers = 1;
+	config.maxWorkers = 6;
+	config.growThreshold = std::chrono::milliseconds(5);
+	config.idleTimeout = std::chrono::milliseconds(100);
+	config.resizeCooldown = std::chrono::milliseconds(50);
+	WorkerPool pool(1, config);
+
+	std::cout << "Elastic: " << (pool.isElastic() ? "yes" : "no") << ", initial size: " << pool.size() << std::endl;
+
+	// A burst of blocking jobs queues up behind the single worker
+	for (int i = 0; i < 60; ++i)
+		pool.addJob([]() { std::this_thread::sleep_for(std::chrono::milliseconds(10)); });
+	pool.waitAll();
+
+	WorkerPool::Stats stats = pool.stats();
+	std::cout << "Grew under burst: " << (stats.peakWorkers > 1 ? "yes" : "no")
+			  << " (peak " << stats.peakWorkers << "/" << config.maxWorkers << ")" << std::endl;
+
+	auto start = std::chrono::steady_clock::now();
+	while (pool.size() > config.minWorkers && std::chrono::steady_clock::now() - start < std::chrono::seconds(3))
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+	stats = pool.stats();
+	std::cout << "Shrunk back to min after idle: " << (stats.workers == config.minWorkers ? "yes" : "no")
+			  << ", grown == retired: " << (stats.grown == stats.retired ? "yes" : "no") << std::endl;
+
+	completedJobs.store(0);
+	for (int i = 0; i < 100; ++i)
+		pool.addJob([]() { completedJobs.fetch_add(1); });
+	pool.waitAll();
+	std::cout << "Jobs after shrink: " << completedJobs.load() << "/100" << std::endl;
+
+	try {
+		WorkerPool::Config invalid;
+		invalid.minWorkers = 4;
+		invalid.maxWorkers = 2;
+		WorkerPool broken(2, invalid);
+	} catch (const std::exception &e) {
+		std::cout << "Invalid bounds rejected: " << e.what() << std::endl;
+	}
+}
+
+void test_worker_placement() {
+	std::cout << "\n=== Worker Placement Test ===" << std::endl;
+
+	WorkerPool::Config config;
+	config.workerAttributes.name = "placed";
+	config.pinWorkers = true;
+	WorkerPool pool(2, config);
+
+	std::mutex mutex;
+	std::set<std::string> names;
+	bool allPinned = true;
+	for (int i = 0; i < 64; ++i) {
+		pool.addJob([&]() {
+			std::string name = ThreadAttributes::currentName();
+			size_t cpus = ThreadAttributes::currentAffinity().size();
+			std::lock_guard<std::mutex> lock(mutex);
+			names.insert(name);
+			allPinned = allPinned && cpus == 1;
+		});
+	}
+	pool.waitAll();
+
+	bool named = true;
+	for (const std::string &name : names)
+		named = named && name.rfind("placed-", 0) == 0;
+	std::cout << "Workers carry OS names: " << (named ? "yes" : "no") << std::endl;
+	std::cout << "Every worker pinned to one CPU: " << (allPinned ? "yes" : "no") << std::endl;
+}
+
+void test_job_stats() {
+	std::cout << "\n=== Job Stats Test ===" << std::endl;
+
+	WorkerPool::Config config;
+	config.recordStats = true;
+	WorkerPool pool(2, config);
+
+	for (int i = 0; i < 100; ++i) {
+		pool.addJob([]() {
+			auto until = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+			while (std::chrono::steady_clock::now() < until)
+				;
+		});
+	}
+	pool.waitAll();
+
+	WorkerPool::Stats stats = pool.stats();
+	double busy = 0;
+	for (const WorkerPool::WorkerStats &worker : stats.perWorker)
+		busy += worker.busyRatio;
+
+	std::cout << "Jobs completed: " << stats.jobsCompleted << "/100" << std::endl;
+	std::cout << "Wait samples: " << stats.wait.count << ", execution samples: " << stats.execution.count << std::endl;
+	std::cout << "Execution p50 >= 150us: " << (stats.execution.percentile(0.5) >= 150000 ? "yes" : "no") << std::endl;
+	std::cout << "Queue drained: " << (stats.queueDepth == 0 ? "yes" : "no")
+			  << ", workers reported busy: " << (busy > 0 ? "yes" : "no") << std::endl;
+
+	WorkerPool plain(2);
+	plain.addJob([]() {});
+	plain.waitAll();
+	std::cout << "Disabled pool records nothing: " << (plain.stats().execution.count == 0 ? "yes" : "no") << std::endl;
+}
+
+void test_scheduled_jobs() {
+	std::cout << "\n=== Scheduled Jobs Test ===" << std::endl;
+
+	WorkerPool pool(2);
+	std::atomic<int> delayed{0};
+	std::atomic<int> cancelled{0};
+	std::atomic<int> ticks{0};
+	auto start = std::chrono::steady_clock::now();
+	std::atomic<long> firedAfterMs{0};
+
+	pool.schedule(std::chrono::milliseconds(50), [&]() {
+		firedAfterMs.store(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+		delayed.fetch_add(1);
+	});
+	TimerHandle doomed = pool.schedule(std::chrono::milliseconds(50), [&]() { cancelled.fetch_add(1); });
+	TimerHandle periodic = pool.scheduleEvery(std::chrono::milliseconds(10), [&]() { ticks.fetch_add(1); });
+
+	std::cout << "Cancel before firing succeeds: " << (doomed.cancel() ? "yes" : "no") << std::endl;
+	std::cout << "Second cancel is a no-op: " << (!doomed.cancel() ? "yes" : "no") << std::endl;
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(150));
+	periodic.cancel();
+	int ticksAtCancel = ticks.load();
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+	std::cout << "Delayed job ran once after >= 50ms: " << (delayed.load() == 1 && firedAfterMs.load() >= 50 ? "yes" : "no") << std::endl;
+	std::cout << "Cancelled job never ran: " << (cancelled.load() == 0 ? "yes" : "no") << std::endl;
+	std::cout << "Periodic job ticked repeatedly: " << (ticksAtCancel >= 5 ? "yes" : "no") << std::endl;
+	std::cout << "Periodic job stopped after cancel: " << (ticks.load() <= ticksAtCancel + 1 ? "yes" : "no") << std::endl;
+	std::cout << "Pending timers left: " << pool.pendingTimers() << std::endl;
+
+	try {
+		pool.scheduleEvery(std::chrono::milliseconds(0), []() {});
+	} catch (const std::exception &e) {
+		std::cout << "Zero period rejected: " << e.what() << std::endl;
+	}
+
+	std::vector<TimerHandle> distant;
+	for (int i = 0; i < 1000; ++i)
+		distant.push_back(pool.schedule(std::chrono::seconds(60), []() {}));
+	for (int i = 0; i < 900; ++i)
+		distant[i].cancel();
+	std::cout << "Cancelled timers not pending: " << (pool.pendingTimers() == 100 ? "yes" : "no") << std::endl;
+	pool.schedule(std::chrono::seconds(60), []() {});
+	std::cout << "Live timers kept after compaction: " << (pool.pendingTimers() == 101 && distant[999].isActive() ? "yes" : "no") << std::endl;
+	for (int i = 900; i < 1000; ++i)
+		distant[i].cancel();
+
+	// Timers still pending at destruction are dropped
+	TimerHandle orphan;
+	{
+		WorkerPool shortLived(1);
+		orphan = shortLived.schedule(std::chrono::seconds(10), []() {});
+	}
+	std::cout << "Pending timer inactive after pool destruction: " << (!orphan.isActive() ? "yes" : "no") << std::endl;
+}
+
 int main() {
 	std::cout << "Starting comprehensive WorkerPool testing..." << std::endl;
 	
@@ -775,6 +989,12 @@ int main() {
 	
 	test_polymorphic_jobs();
 	test_performance_comparison();
+	test_idle_policies();
+	test_nested_jobs();
+	test_elastic_pool();
+	test_worker_placement();
+	test_job_stats();
+	test_scheduled_jobs();
 	
 	std::cout << "\nAll WorkerPool tests completed!" << std::endl;
 	return 0;
@@ -0,0 +1,24 @@
+#include <iostream>
+#include <fstream>
+#include "../libftpp.hpp"
+
+/*
+** Turns files written by Log::BinaryLog in path mode back into text:
+**   ftpp_logdecode app.blog [more.blog ...] > app.log
+** With no argument it reads standard input.
+*/
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		Log::BinaryLog::decode(std::cin, std::cout);
+		return 0;
+	}
+	for (int i = 1; i < argc; ++i) {
+		std::ifstream in(argv[i], std::ios::binary);
+		if (!in) {
+			std::cerr << "ftpp_logdecode: cannot open " << argv[i] << std::endl;
+			return 1;
+		}
+		Log::BinaryLog::decode(in, std::cout);
+	}
+	return 0;
+}